@@ -11,7 +11,10 @@
 
 #include "DIO_Interface.h"
 #include "Ex_Interrupt_Interface.h"
-#include "Timer_Interface.h"
+#include "Button_Interface.h"
+#include "SysTime_Interface.h"
+#include "SoftTimer_Interface.h"
+#include "Supervisor_Interface.h"
 
 #include "Queue_Interface.h"
 
@@ -20,31 +23,40 @@
 #include "EventBased_Config.h"
 
 CircularQueue_type Queue;
+static u8 EventBased_u8ButtonTimer;
+static u8 EventBased_u8Task;
 
 /**
  * @brief Initializes the event-driven architecture components, configuring the 
  *        digital I/O, external interrupts, timers, and the event queue.
  *
- *        Sets up DIO, defines the trigger for external interrupts, and initializes
- *        Timer1 for generating periodic timer events. Registers callback functions
- *        for handling external and timer-based interrupts and enables global 
- *        interrupts.
- *
- * @return None
+ *        Sets up DIO, defines the trigger for external interrupts, and starts
+ *        a periodic software timer for polling BUTTON2. Registers callback functions
+ *        for handling external interrupt and timer events and enables global 
+ *        interrupts. The runnable is registered in the watchdog supervisor and
+ *        WATCHDOG_RESET_PIN is set if the last reset came from the watchdog.
+ *
+ * @return None
  */
 void EventBased_Init()
 {
+	Supervisor_Init();
+	Supervisor_Register(&EventBased_u8Task,RUNNABLE_DEADLINE_MS);
 	DIO_Init();
+	if(Supervisor_GetResetTask()!=SUPERVISOR_NO_RESET)
+	{
+		DIO_WritePin(WATCHDOG_RESET_PIN,HIGH);
+	}
+	Button_Init();
 	EXI_TriggerEdge(EX_INT0,FALLING_EDGE);
 	EXI_SetCallBack(EX_INT0,CallBack_INT0);
-	Timer1_Init(TIMER1_CTC_OCRA_TOP_MODE,TIMER1_SCALER_64);
-	Timer1_OCRA1Mode(OCRB_NON_INVERTING);
-	OCR1A=SET_50MS;
-	Timer1_OCA_SetCallBack(CallBack_Timer1);
+	SysTime_Init();
+	SoftTimer_Init();
+	SoftTimer_Create(&EventBased_u8ButtonTimer,CallBack_Timer1,SOFTTIMER_PERIODIC);
 	CircularQueue_Init(&Queue);
 	sei();  // Enable global interrupts
 	EXI_Enable(EX_INT0);
-	Timer1_OCA_InterruptEnable();
+	SoftTimer_Start(EventBased_u8ButtonTimer,BUTTON2_POLL_MS);
 }
 /**
  * @brief Callback function triggered by the external interrupt (INT0).
@@ -60,26 +72,19 @@ static void CallBack_INT0()
 }
 
 /**
- * @brief Callback function for Timer1 compare match events.
- *
- *        Checks the state of a button connected to PINC7. If the button 
- *        is pressed (PINC7 is LOW) and a flag is cleared, an event for 
- *        BUTTON2 is enqueued. The flag prevents duplicate entries until 
- *        the button is released.
- *
- * @return None
+ * @brief Periodic software timer callback (every BUTTON2_POLL_MS).
+ *
+ *        Samples the buttons through the debouncer of the Button HAL and
+ *        enqueues an event for BUTTON2 (PINC7) once per debounced press.
+ *
+ * @return None
  */
 static void CallBack_Timer1()
 {
-	static u8 Local_u8Flag=0;
-	if(DIO_ReadPin(PINC7)==LOW && Local_u8Flag==0)
+	Button_Update();
+	if(Button_GetPressed(PC)&BUTTON2_MASK)
 	{
 		Enqueue(&Queue,BUTTON2_WITH_TIMER_INT);
-		Local_u8Flag=1;
-	}
-	else if(DIO_ReadPin(PINC7)==HIGH)
-	{
-		Local_u8Flag=0;
 	}
 }
 
@@ -93,6 +98,8 @@ static void CallBack_Timer1()
 void EventBased_Runnable()
 {
 	u8 Local_u8Data=0;
+	Supervisor_CheckIn(EventBased_u8Task);
+	SoftTimer_Dispatch();
 	DeQueue(&Queue,&Local_u8Data);
 	switch(Local_u8Data)
 	{
@@ -9,7 +9,13 @@
 #ifndef EVENTBASED_CONFIG_H_
 #define EVENTBASED_CONFIG_H_
 
-#define SET_50MS     6249
+/*sample period of the button debouncer (BUTTON_SAMPLE_MS of Button_Cfg.h)*/
+#define BUTTON2_POLL_MS     10
+
+/*EventBased_Runnable must run at least every RUNNABLE_DEADLINE_MS or the watchdog resets the MCU*/
+#define RUNNABLE_DEADLINE_MS    100
+/*set after a watchdog reset*/
+#define WATCHDOG_RESET_PIN      PINC3
 
 
 
@@ -13,10 +13,11 @@
  * @brief Initializes the event-driven architecture components, configuring the 
  *        digital I/O, external interrupts, timers, and the event queue.
  *
- *        Sets up DIO, defines the trigger for external interrupts, and initializes
- *        Timer1 for generating periodic timer events. Registers callback functions
- *        for handling external and timer-based interrupts and enables global 
- *        interrupts.
+ *        Sets up DIO, defines the trigger for external interrupts, and starts
+ *        a periodic software timer for polling BUTTON2. Registers callback functions
+ *        for handling external interrupt and timer events and enables global 
+ *        interrupts. The runnable is registered in the watchdog supervisor and
+ *        WATCHDOG_RESET_PIN is set if the last reset came from the watchdog.
  *
  * @return None
  */
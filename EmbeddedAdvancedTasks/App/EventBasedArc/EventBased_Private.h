@@ -12,6 +12,8 @@
 #define BUTTON1_WITH_EXT_INT0      1
 #define BUTTON2_WITH_TIMER_INT     2
 
+#define BUTTON2_MASK               (1<<7)   /*PINC7 in the debounced port C*/
+
 
 /**
  * @brief Callback function triggered by the external interrupt (INT0).
@@ -24,12 +26,10 @@
 static void CallBack_INT0(void);
 
 /**
- * @brief Callback function for Timer1 compare match events.
+ * @brief Periodic software timer callback (every BUTTON2_POLL_MS).
  *
- *        Checks the state of a button connected to PINC7. If the button 
- *        is pressed (PINC7 is LOW) and a flag is cleared, an event for 
- *        BUTTON2 is enqueued. The flag prevents duplicate entries until 
- *        the button is released.
+ *        Samples the buttons through the debouncer of the Button HAL and
+ *        enqueues an event for BUTTON2 (PINC7) once per debounced press.
  *
  * @return None
  */
@@ -14,7 +14,8 @@
 #include "DIO_Interface.h"
 
 #include "Ex_Interrupt_Interface.h"
-#include "Timer_Interface.h"
+#include "SysTime_Interface.h"
+#include "SoftTimer_Interface.h"
 #include "Graphical_LCD_Interface.h"
 
 #include "FixedPoint_Interface.h"
@@ -39,6 +40,7 @@ static volatile u8 TotalScore = 0; // Player's score
 
 extern void(*currentState)(void); // Pointer to the current game state function
 CircularQueue_type Queue; // Queue for managing game events
+static u8 ObstacleTimer; // Soft timer of the obstacles reset event
 
 /**
  * @brief Callback for external interrupt 0 (INT0).
@@ -69,20 +71,14 @@ static void CallBack_INT1()
 }
 
 /**
- * @brief Callback for Timer1 Compare Match interrupt.
+ * @brief Periodic software timer callback.
  * 
- * Adds an event to the queue every 1 second.
- * This function is called periodically based on timer settings.
+ * Adds an event to the queue every OBSTACLE_EVENT_MS.
+ * This function is called from SoftTimer_Dispatch in the game loop.
  */
 static void CallBack_Timer1()
 {
-    static u8 Local_u8Counter = 0; // Counter for timing events
-    if (Local_u8Counter == 3)
-    {
-        Enqueue(&Queue, 1); // Add an event to the queue
-        Local_u8Counter = 0; // Reset counter
-    }
-    Local_u8Counter++; // Increment counter
+    Enqueue(&Queue, 1); // Add an event to the queue
 }
 
 /**
@@ -98,15 +94,14 @@ void FlappyBird_voidInit()
     EXI_TriggerEdge(EX_INT1, FALLING_EDGE); // Configure external interrupt 1
     EXI_SetCallBack(EX_INT0, CallBack_INT0); // Set callback for INT0
     EXI_SetCallBack(EX_INT1, CallBack_INT1); // Set callback for INT1
-    Timer1_Init(TIMER1_CTC_OCRA_TOP_MODE, TIMER1_SCALER_64); // Initialize Timer1
-    Timer1_OCRA1Mode(OCRB_NON_INVERTING); // Set output compare mode
-    OCR1A = 124999; // Set Timer1 to trigger every 1 second
-    Timer1_OCA_SetCallBack(CallBack_Timer1); // Set Timer1 callback
+    SysTime_Init(); // Start Timer1 free running
+    SoftTimer_Init(); // Start the software timers tick
+    SoftTimer_Create(&ObstacleTimer, CallBack_Timer1, SOFTTIMER_PERIODIC); // Obstacles event timer
     GLCD_voidInit(); // Initialize the graphical LCD
     sei(); // Enable global interrupts
     EXI_Enable(EX_INT0); // Enable external interrupt 0
     EXI_Enable(EX_INT1); // Enable external interrupt 1
-    Timer1_OCA_InterruptEnable(); // Enable Timer1 interrupt
+    SoftTimer_Start(ObstacleTimer, OBSTACLE_EVENT_MS); // Add an event every OBSTACLE_EVENT_MS
     CircularQueue_Init(&Queue); // Initialize the queue
     Stack_Push(FlappyBird_voidGameOver); // Push game over state onto the stack
     Stack_Push(FlappyBird_voidStartGame); // Push start game state onto the stack
@@ -156,6 +151,7 @@ static void FlappyBird_voidStartGame()
     GLCD_voidClear(); // Clear the GLCD for a fresh frame
     while (READ_BIT(PauseStartFlag, 2) == START_VALUE) // Continue while game is active
     {   
+        SoftTimer_Dispatch(); // Run the expired software timers
         Local_u8BirdSpeed = FlappyBird_voidBirdSpeed(); // Get current bird speed
         if (IsEmpty(&Queue) != QUEUE_EMPTY) // Check if there are events in the queue
         {
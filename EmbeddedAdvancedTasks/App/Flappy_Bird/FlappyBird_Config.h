@@ -12,6 +12,7 @@
 #define START_PAGE_FOR_BIRD      3
 #define PAUSE_VALUE              0
 #define START_VALUE              1
+#define OBSTACLE_EVENT_MS        3000
 
 
 
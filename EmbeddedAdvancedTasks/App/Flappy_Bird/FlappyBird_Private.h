@@ -23,10 +23,10 @@ static void CallBack_INT0(void);
  */
 static void CallBack_INT1(void);
 /**
- * @brief Callback for Timer1 Compare Match interrupt.
+ * @brief Periodic software timer callback.
  * 
- * Adds an event to the queue every 1 second.
- * This function is called periodically based on timer settings.
+ * Adds an event to the queue every OBSTACLE_EVENT_MS.
+ * This function is called from SoftTimer_Dispatch in the game loop.
  */
 static void CallBack_Timer1(void);
 /**
@@ -10,7 +10,8 @@
 #include "MemMap.h"
 
 #include "DIO_Interface.h"
-#include "Timer_Interface.h"
+#include "SysTime_Interface.h"
+#include "SoftTimer_Interface.h"
 
 #include "LCD_Interface.h"
 
@@ -22,45 +23,43 @@
 static void (*Stcak_Arr[STACK_SIZE])(void);
 static void (*currentState)(void) = NULL;
 static s8 StackPointer=STACK_POINTER_INIT;
+static u8 TrafficLight_u8Timer;
+static u8 TrafficLight_u8LcdTimer;
+/*state already shown, the LEDs and the LCD are only written on a change*/
+static void (*shownState)(void) = NULL;
 
+/*soft timer call back, every NUMBER_OF_SECOND from the main loop*/
 static void Stack_CallBack()
 {
-	static u8 Local_u8Counter=0;
-	Local_u8Counter++;
-	if(Local_u8Counter==NUMBER_OF_SECOND)
+	Stack_Pop();
+	if (StackPointer == -1)
+    {
+		// If the stack is empty, reset and start with red
+		Stack_Push(Red_Led);
+	}
+	else
 	{
-		Stack_Pop();
-		if (StackPointer == -1)
-	    {
-			// If the stack is empty, reset and start with red
-			Stack_Push(Red_Led);
+		// Cycle through states
+		if (currentState == Red_Led) {
+			Stack_Push(Yellow_Led);
+			} else if (currentState == Green_Led) {
+			Stack_Push(Red_Led);
+			} else if (currentState == Yellow_Led) {
+			Stack_Push(Green_Led);
 		}
-		else
-		{
-			// Cycle through states
-			if (currentState == Red_Led) {
-				Stack_Push(Yellow_Led);
-				} else if (currentState == Green_Led) {
-				Stack_Push(Red_Led);
-				} else if (currentState == Yellow_Led) {
-				Stack_Push(Green_Led);
-			}
-		}
-		Local_u8Counter=0;
 	}
-	
 }
 void TrafficLight_voidInit(void)
 {
 	DIO_Init();
 	LCD_Init();
-	Timer1_Init(TIMER1_CTC_OCRA_TOP_MODE,TIMER1_SCALER_64);
-	Timer1_OCRB1Mode(OCRB_NON_INVERTING);
-	/*Value of 1 sec*/
-	OCR1A=ONE_SECOND_WITH_64PRESCALLER_VALUE; 
-	Timer1_OCA_SetCallBack(Stack_CallBack);
+	SysTime_Init();
+	SoftTimer_Init();
+	SoftTimer_Create(&TrafficLight_u8Timer,Stack_CallBack,SOFTTIMER_PERIODIC);
+	SoftTimer_Start(TrafficLight_u8Timer,TRAFFIC_LIGHT_PERIOD_MS);
+	SoftTimer_Create(&TrafficLight_u8LcdTimer,LCD_Refresh,SOFTTIMER_PERIODIC);
+	SoftTimer_Start(TrafficLight_u8LcdTimer,LCD_REFRESH_PERIOD_MS);
 	sei();
-	Timer1_OCA_InterruptEnable();
 	
 	/* Initialize the stack with state functions*/
 	Stack_Push(Green_Led);
@@ -71,9 +70,11 @@ void TrafficLight_voidInit(void)
 
 void TrafficLight_voidRunnable(void)
 {
-	if(currentState!=NULL)
+	SoftTimer_Dispatch();
+	if((currentState!=NULL)&&(currentState!=shownState))
 	{
 		currentState();
+		shownState=currentState;
 	}
 	else
 	{
@@ -117,10 +118,8 @@ static void Red_Led(void)
 	DIO_WritePin(LED_YELLOW_PIN,LOW);
 	DIO_WritePin(LED_GREEN_PIN,LOW);
 	DIO_WritePin(LED_RED_PIN,HIGH);
-	LCD_SetCurser(0,12);
-	LCD_WriteString("      ");
-	LCD_SetCurser(0,0);
-	LCD_WriteString("Stop Driving");
+	LCD_BufferSetCurser(0,0);
+	LCD_BufferWriteString("Stop Driving    ");
 }
 
 static void Yellow_Led(void)
@@ -128,8 +127,8 @@ static void Yellow_Led(void)
 	DIO_WritePin(LED_GREEN_PIN,LOW);
 	DIO_WritePin(LED_RED_PIN,LOW);
 	DIO_WritePin(LED_YELLOW_PIN,HIGH);
-	LCD_SetCurser(0,0);
-	LCD_WriteString("Stopping Soon");
+	LCD_BufferSetCurser(0,0);
+	LCD_BufferWriteString("Stopping Soon   ");
 }
 
 static void Green_Led(void)
@@ -137,8 +136,6 @@ static void Green_Led(void)
 	DIO_WritePin(LED_RED_PIN,LOW);
 	DIO_WritePin(LED_YELLOW_PIN,LOW);
 	DIO_WritePin(LED_GREEN_PIN,HIGH);
-	LCD_SetCurser(0,13);
-	LCD_WriteString("      ");
-	LCD_SetCurser(0,0);
-	LCD_WriteString("Start Driving");
+	LCD_BufferSetCurser(0,0);
+	LCD_BufferWriteString("Start Driving   ");
 }
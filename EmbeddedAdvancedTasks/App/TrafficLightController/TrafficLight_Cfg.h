@@ -15,8 +15,10 @@
 #define LED_YELLOW_PIN  PINC1  
 #define LED_GREEN_PIN  PINC2
 
-#define ONE_SECOND_WITH_64PRESCALLER_VALUE    124999
 #define NUMBER_OF_SECOND          5
+#define TRAFFIC_LIGHT_PERIOD_MS   ((u16)NUMBER_OF_SECOND*1000)
+/*LCD shadow buffer refresh, LCD_REFRESH_CHARS cells every tick*/
+#define LCD_REFRESH_PERIOD_MS     10
 
 
 #endif /* TRAFFICLIGHT_CFG_H_ */
\ No newline at end of file
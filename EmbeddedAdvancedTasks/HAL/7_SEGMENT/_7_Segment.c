@@ -1,42 +1,116 @@
 
 #include "StdTypes.h"
+#include "MemMap.h"
 /*Include From MCAL*/
 #include "DIO_Interface.h"
+#include "Timer_Interface.h"
+/*Include From Service*/
+#include "NumFormat_Interface.h"
 /*Include From HAL*/
 #include "_7_Segment_Interface.h"
-#include "_7_Segment_Private.h"
 #include "_7_Segment_Cfg.h"
+#include "_7_Segment_Private.h"
+
+static const DIO_Pin_type SevenSeg_DigitPins[SEVENSEG_DIGITS]=SEVENSEG_DIGIT_PINS;
+/*port value of every digit , the ISR only copies it*/
+static volatile u8 SevenSeg_Buffer[SEVENSEG_DIGITS];
+static u8 SevenSeg_Current=0;
+static volatile u8 SevenSeg_Brightness=SEVENSEG_BRIGHTNESS;
+
+void Seven_SegmentDisplay(u8 num)
+{
+	SevenSeg_SetNumber(num);
+}
+void Seven_SegmentDisplay_BCD(u8 num)
+{
+	unsigned char p1,p2,Value_Port;
+	p1=num/10;
+	p2=num%10;
+	Value_Port=(p1<<4)|(p2);
+	DIO_WritePort(SEGMENT_PORT,Value_Port);
+}
+void Seven_SegmentDisplay_BCD_HEXA(u8 num)
+{
+	DIO_WritePort(SEGMENT_PORT,num);
+}
+
+void SevenSeg_Init(void)
+{
+	u8 i;
+	for(i=0;i<SEVENSEG_DIGITS;i++)
+	{
+		DIO_WritePin(SevenSeg_DigitPins[i],SEVENSEG_DIGIT_OFF);
+		SevenSeg_Buffer[i]=SEVENSEG_PORT_VALUE(SEVENSEG_BLANK);
+	}
+	SevenSeg_Current=0;
+	/*normal mode : the overflow starts a digit and the compare match ends it*/
+	OCR0=SevenSeg_Brightness;
+	TIMER0_OV_SetCallBack(SevenSeg_NextDigit);
+	TIMER0_OC_SetCallBack(SevenSeg_DigitOff);
+	TIMER0_Init(TIMER0_NORMAL_MODE,SEVENSEG_SCALER);
+	TIMER0_OV_InterruptEnable();
+	TIMER0_OC_InterruptEnable();
+}
+
+void SevenSeg_SetNumber(u16 num)
+{
+	u8 digits[SEVENSEG_DIGITS+1],i;
+	NumFormat_U32Digits(num,SEVENSEG_DIGITS,digits);
+	/*leading zeros are blank , the last digit always shows*/
+	for(i=0;(i<SEVENSEG_DIGITS-1)&&(digits[i]=='0');i++)
+	{
+		SevenSeg_Buffer[i]=SEVENSEG_PORT_VALUE(SEVENSEG_BLANK);
+	}
+	for(;i<SEVENSEG_DIGITS;i++)
+	{
+		SevenSeg_Buffer[i]=SEVENSEG_PORT_VALUE(SegmentArr[digits[i]-'0']);
+	}
+}
+
+void SevenSeg_SetDigit(u8 digit,u8 value)
+{
+	if(value<10)
+	{
+		SevenSeg_SetSegments(digit,SegmentArr[value]);
+	}
+	else
+	{
+		SevenSeg_SetSegments(digit,SEVENSEG_BLANK);
+	}
+}
+
+void SevenSeg_SetSegments(u8 digit,u8 pattern)
+{
+	if(digit<SEVENSEG_DIGITS)
+	{
+		SevenSeg_Buffer[digit]=SEVENSEG_PORT_VALUE(pattern);
+	}
+}
+
+void SevenSeg_SetBrightness(u8 level)
+{
+	/*takes effect from the next compare match*/
+	SevenSeg_Brightness=level;
+	OCR0=level;
+}
+
+/*Timer0 overflow : the previous digit is already off , show the next one*/
+static void SevenSeg_NextDigit(void)
+{
+	SevenSeg_Current++;
+	if(SevenSeg_Current==SEVENSEG_DIGITS)
+	{
+		SevenSeg_Current=0;
+	}
+	DIO_WritePort(SEGMENT_PORT,SevenSeg_Buffer[SevenSeg_Current]);
+	if(SevenSeg_Brightness)
+	{
+		DIO_WritePin(SevenSeg_DigitPins[SevenSeg_Current],SEVENSEG_DIGIT_ON);
+	}
+}
 
-#define F_CPU  8000000
-#include <util/delay.h>
-
-
-void Seven_SegmentDisplay(u8 num)
-{
-	u8 p1,p2;
-	p1=num/10;
-	p2=num%10;
-	/*for Common Anode*/
-	//SEGMENT_PORT=~SegmentArr[p1];
-	/* for Common Cathode */
-	DIO_WritePin(SEGMENT_PIN1,HIGH);
-	DIO_WritePort(SEGMENT_PORT,SegmentArr[p2]<<1);
-	DIO_WritePin(SEGMENT_PIN2,LOW);
-	_delay_ms(1);
-	DIO_WritePin(SEGMENT_PIN2,HIGH);
-	DIO_WritePort(SEGMENT_PORT,SegmentArr[p1]<<1);
-	DIO_WritePin(SEGMENT_PIN1,LOW);
-	_delay_ms(1);
-}
-void Seven_SegmentDisplay_BCD(u8 num)
-{
-	unsigned char p1,p2,Value_Port;
-	p1=num/10;
-	p2=num%10;
-	Value_Port=(p1<<4)|(p2);
-	DIO_WritePort(SEGMENT_PORT,Value_Port);
-}
-void Seven_SegmentDisplay_BCD_HEXA(u8 num)
-{
-	DIO_WritePort(SEGMENT_PORT,num);
+/*Timer0 compare : end of the on time*/
+static void SevenSeg_DigitOff(void)
+{
+	DIO_WritePin(SevenSeg_DigitPins[SevenSeg_Current],SEVENSEG_DIGIT_OFF);
 }
\ No newline at end of file
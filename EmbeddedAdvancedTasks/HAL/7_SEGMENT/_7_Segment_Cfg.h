@@ -7,5 +7,21 @@
 #define SEGMENT_PIN1       PINC6
 #define SEGMENT_PIN2       PINC7
 
+/******** SEVENSEG_COMMON_CATHODE or SEVENSEG_COMMON_ANODE ********/
+#define SEVENSEG_TYPE            SEVENSEG_COMMON_CATHODE
+/*level on the digit pin that turns the digit on (LOW for the cathode directly on the pin)*/
+#define SEVENSEG_DIGIT_ON        LOW
+/*segment a is on SEGMENT_PORT pin SEVENSEG_SEGMENT_SHIFT (a:g on PA1:PA7)*/
+#define SEVENSEG_SEGMENT_SHIFT   1
+
+/*common pins from the left digit to the right one*/
+#define SEVENSEG_DIGITS          2
+#define SEVENSEG_DIGIT_PINS      {SEGMENT_PIN1,SEGMENT_PIN2}
+
+/*Timer0 overflows every 256*64/8MHz=2.048ms , one digit per overflow --> 244Hz/SEVENSEG_DIGITS*/
+#define SEVENSEG_SCALER          TIMER0_SCALER_64
+/*on time of every digit out of 256 (0 : display off)*/
+#define SEVENSEG_BRIGHTNESS      255
+
 
 #endif /* 7_SEGMENT_CFG_H_ */
\ No newline at end of file
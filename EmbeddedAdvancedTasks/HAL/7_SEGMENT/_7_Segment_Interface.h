@@ -3,10 +3,23 @@
 #ifndef _7_SEGMENT_INTERFACE_H_
 #define _7_SEGMENT_INTERFACE_H_
 
+/*same as SevenSeg_SetNumber , the display is refreshed by SevenSeg_Init*/
 void Seven_SegmentDisplay(u8 num);
 void Seven_SegmentDisplay_BCD(u8 num);
 void Seven_SegmentDisplay_BCD_HEXA(u8 num);
 
+/*multiplexes the digits from the Timer0 interrupts , takes the Timer0 overflow and compare call backs
+ *GLOBAL_ENABLE();*/
+void SevenSeg_Init(void);
+/*right aligned decimal without leading zeros , only the lowest SEVENSEG_DIGITS digits are shown*/
+void SevenSeg_SetNumber(u16 num);
+/*digit 0 is the left one , value 0:9 or any other value for a blank digit*/
+void SevenSeg_SetDigit(u8 digit,u8 value);
+/*raw segments of a digit , bit0=a ... bit6=g bit7=dp*/
+void SevenSeg_SetSegments(u8 digit,u8 pattern);
+/*on time of every digit out of 256 , 0 turns the display off*/
+void SevenSeg_SetBrightness(u8 level);
+
 
 
 #endif /* 7_SEGMENT_INTERFACE_H_ */
\ No newline at end of file
@@ -4,6 +4,21 @@
 
 static u8 SegmentArr[10]={0x3f,0x06,0x5b,0x4f,0x66,0x6d,0x7c,0x07,0x7f,0x6f};
 
+#define SEVENSEG_COMMON_CATHODE  0
+#define SEVENSEG_COMMON_ANODE    1
+
+#define SEVENSEG_BLANK           0x00
+#define SEVENSEG_DIGIT_OFF       (!SEVENSEG_DIGIT_ON)
+
+/*value written on SEGMENT_PORT to show a pattern (segment a in bit 0)*/
+#if SEVENSEG_TYPE==SEVENSEG_COMMON_CATHODE
+#define SEVENSEG_PORT_VALUE(pattern)   ((u8)((pattern)<<SEVENSEG_SEGMENT_SHIFT))
+#else
+#define SEVENSEG_PORT_VALUE(pattern)   ((u8)~((pattern)<<SEVENSEG_SEGMENT_SHIFT))
+#endif
+
+static void SevenSeg_NextDigit(void);
+static void SevenSeg_DigitOff(void);
 
 
 #endif /* 7_SEGMENT_PRIVATE_H_ */
\ No newline at end of file
@@ -1,10 +1,23 @@
 
 #include "StdTypes.h"
+#include "MemMap.h"
+#include "Utils.h"
 /*Include From MCAL*/
 #include "DIO_Interface.h"
 /*Include From HAL*/
 #include "Button_Interface.h"
 #include "Button_Cfg.h"
+#include "Button_Private.h"
+
+static const u8 Button_Masks[BUTTON_PORTS]={BUTTON_PORTA_MASK,BUTTON_PORTB_MASK,BUTTON_PORTC_MASK,BUTTON_PORTD_MASK};
+
+/*vertical counter : bit n of Counter0/Counter1 is a 2 bit counter for pin n,
+ *so the 8 pins of a port are debounced with a few logic instructions*/
+static u8 Button_Counter0[BUTTON_PORTS];
+static u8 Button_Counter1[BUTTON_PORTS];
+static volatile u8 Button_State[BUTTON_PORTS];
+static volatile u8 Button_Pressed[BUTTON_PORTS];
+static volatile u8 Button_Released[BUTTON_PORTS];
 
 void Button_Init(void)
 {
@@ -16,6 +29,15 @@ void Button_Init(void)
 	*return value if zero means that the button is pressed
 	*if one the button is not pressed
 	*/
+	u8 port;
+	for(port=0;port<BUTTON_PORTS;port++)
+	{
+		Button_Counter0[port]=0;
+		Button_Counter1[port]=0;
+		Button_State[port]=0;
+		Button_Pressed[port]=0;
+		Button_Released[port]=0;
+	}
 }
 
 Button_value Button_Pins(Button_type button)
@@ -37,4 +59,81 @@ Button_value Button_Pins(Button_type button)
 		break;
 	}
 	return value;
+}
+
+void Button_Update(void)
+{
+	u8 port,sample,delta,changes;
+	for(port=0;port<BUTTON_PORTS;port++)
+	{
+		if(Button_Masks[port]==0)
+		{
+			continue;
+		}
+		sample=DIO_ReadPort((DIO_Port_type)port);
+#if BUTTON_ACTIVE_LOW
+		sample=~sample;
+#endif
+		sample&=Button_Masks[port];
+		/*pins that differ from the debounced state count 1,2,3,0 , the others are reset to 0*/
+		delta=sample^Button_State[port];
+		Button_Counter1[port]=(Button_Counter1[port]^Button_Counter0[port])&delta;
+		Button_Counter0[port]=(~Button_Counter0[port])&delta;
+		/*the counter wrapped to 0 : 4 samples in a row with the new level*/
+		changes=delta&~(Button_Counter0[port]|Button_Counter1[port]);
+		Button_State[port]^=changes;
+		Button_Pressed[port]|=changes&Button_State[port];
+		Button_Released[port]|=changes&~Button_State[port];
+	}
+}
+
+Button_value Button_Debounced(Button_type button)
+{
+	Button_value value=NOT_PRESSED;
+	u8 pin=BUTTON1_PIN;
+	switch(button)
+	{
+		case BUTTON_1:
+		pin=BUTTON1_PIN;
+		break;
+		case BUTTON_2:
+		pin=BUTTON2_PIN;
+		break;
+		case BUTTON_3:
+		pin=BUTTON3_PIN;
+		break;
+		case BUTTON_4:
+		pin=BUTTON4_PIN;
+		break;
+	}
+	if(READ_BIT(Button_State[BUTTON_PORT(pin)],BUTTON_BIT(pin)))
+	{
+		value=PRESSED;
+	}
+	return value;
+}
+
+u8 Button_GetState(DIO_Port_type port)
+{
+	return Button_State[port];
+}
+
+u8 Button_GetPressed(DIO_Port_type port)
+{
+	u8 mask,sreg=SREG;
+	cli();
+	mask=Button_Pressed[port];
+	Button_Pressed[port]=0;
+	SREG=sreg;
+	return mask;
+}
+
+u8 Button_GetReleased(DIO_Port_type port)
+{
+	u8 mask,sreg=SREG;
+	cli();
+	mask=Button_Released[port];
+	Button_Released[port]=0;
+	SREG=sreg;
+	return mask;
 }
\ No newline at end of file
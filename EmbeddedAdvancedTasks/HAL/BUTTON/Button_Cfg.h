@@ -7,5 +7,17 @@
 #define BUTTON3_PIN  PIND4
 #define BUTTON4_PIN  PIND5
 
+/*pins debounced by Button_Update in every port (1 = debounced)*/
+#define BUTTON_PORTA_MASK   0x00
+#define BUTTON_PORTB_MASK   0x00
+#define BUTTON_PORTC_MASK   0x80    /*PINC7*/
+#define BUTTON_PORTD_MASK   0x3C    /*BUTTON1:BUTTON4*/
+
+/*1 : the buttons pull the pin to GND (INPULL) , 0 : the buttons drive the pin HIGH*/
+#define BUTTON_ACTIVE_LOW   1
+
+/*a pin changes state after 4 equal samples , debounce time = 4*BUTTON_SAMPLE_MS*/
+#define BUTTON_SAMPLE_MS    10
+
 
 #endif /* BUTTON_CFG_H_ */
\ No newline at end of file
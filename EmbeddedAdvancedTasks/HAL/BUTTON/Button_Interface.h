@@ -14,6 +14,18 @@ typedef enum{
 	}Button_value;
 
 void Button_Init(void);
+/*raw level of the pin , not debounced*/
 Button_value Button_Pins(Button_type button);
 
+/*samples the configured ports and debounces all their pins together,
+ *call it every BUTTON_SAMPLE_MS (soft timer or timer ISR)*/
+void Button_Update(void);
+/*debounced state of a button*/
+Button_value Button_Debounced(Button_type button);
+/*debounced pins of a port , bit=1 pressed*/
+u8 Button_GetState(DIO_Port_type port);
+/*pins pressed / released since the last call of the same function , the mask is cleared by the read*/
+u8 Button_GetPressed(DIO_Port_type port);
+u8 Button_GetReleased(DIO_Port_type port);
+
 #endif /* BUTTON_INTERFACE_H_ */
\ No newline at end of file
@@ -0,0 +1,9 @@
+
+#ifndef BUTTON_PRIVATE_H_
+#define BUTTON_PRIVATE_H_
+
+#define BUTTON_PORTS        4
+#define BUTTON_PORT(pin)    ((pin)>>3)
+#define BUTTON_BIT(pin)     ((pin)&7)
+
+#endif /* BUTTON_PRIVATE_H_ */
\ No newline at end of file
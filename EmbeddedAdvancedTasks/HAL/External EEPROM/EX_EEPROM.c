@@ -6,70 +6,89 @@
 #include "EX_EEPROM_Private.h"
 #include "EX_EEPROM_Cfg.h"
 
-#include "LCD_Interface.h"
+void Ex_EEPROMInit(void)
+{
+	/*TWI is the master, the EEPROM doesn't need an own address*/
+	TWI_voidMasterInit(0);
+}
 
-void Ex_EEPROMInit(void);
 TWI_ErrStatus EX_EEPROMWriteData(u16 Copy_u16Address,u8 Copy_u8DataByte)
 {
-	u8 x=0;
-	LCD_SetCurser(0,0);
-	LCD_WriteNumber(x);
-	LCD_Init();
+	return EX_EEPROMWriteBlock(Copy_u16Address,&Copy_u8DataByte,1);
+}
+
+TWI_ErrStatus EX_EEPROMReadData(u16 Copy_u16Address,u8*Copy_u8DataByte)
+{
+	return EX_EEPROMReadBlock(Copy_u16Address,Copy_u8DataByte,1);
+}
+
+TWI_ErrStatus EX_EEPROMWriteBlock(u16 Copy_u16Address,const u8*Copy_pu8Data,u16 Copy_u16Length)
+{
 	TWI_ErrStatus Local_ErrStatus=NoError;
-	if(TWI_SendStartCondition()==NoError)
+	u16 Local_u16ChunkLength;
+	if((u32)Copy_u16Address+Copy_u16Length>EX_EEPROM_SIZE)
+	{
+		Local_ErrStatus=MasterWriteByteErr;
+	}
+	while((Copy_u16Length!=0)&&(Local_ErrStatus==NoError))
 	{
-		x++;
-		LCD_SetCurser(0,0);
-		LCD_WriteNumber(x);
-		//(10100000|0<<2|(Copy_u16Address>>8))
-		//((0XA0)|(0<<2)|(Copy_u16Address>>8)
-		//((0XA0)|(0<<2)|(Copy_u16Address>>8))
-		if(TWI_SendSlaveAddressWithWrite((u8)((0x0A)|((Copy_u16Address&0x0700)>>7)))==NoError)
+		/*a page write can't cross the page boundary (the address wraps inside the page)
+		 *so write up to the end of the current page in one transaction*/
+		Local_u16ChunkLength=EX_EEPROM_PAGE_SIZE-(Copy_u16Address&(EX_EEPROM_PAGE_SIZE-1));
+		if(Local_u16ChunkLength>Copy_u16Length)
 		{
-			x++;
-			LCD_SetCurser(0,0);
-			LCD_WriteNumber(x);
-			if(TWI_MasterWriteDataByte((u8)Copy_u16Address)==NoError)
-			{
-				x++;
-				LCD_SetCurser(0,0);
-				LCD_WriteNumber(x);
-				if(TWI_MasterWriteDataByte(Copy_u8DataByte)==NoError)
-				{
-					x++;
-					LCD_SetCurser(0,0);
-					LCD_WriteNumber(x);
-					TWI_SendStopCondition();
-				}
-				else
-				{
-					Local_ErrStatus=MasterWriteByteErr;
-				}
-			}
-			else
-			{
-				Local_ErrStatus=MasterWriteByteErr;
-			}
+			Local_u16ChunkLength=Copy_u16Length;
 		}
-		else
+		Local_ErrStatus=TWI_WriteBurst(EX_EEPROM_SLAVE_ADDRESS(Copy_u16Address),(u8)Copy_u16Address,Copy_pu8Data,Local_u16ChunkLength);
+		if(Local_ErrStatus==NoError)
 		{
-			LCD_SetCurser(1,0);
-			LCD_WriteNumber(6);
-			Local_ErrStatus=SlaveAddressWithWriteErr;
+			/*wait the internal write cycle by polling instead of a fixed 5ms delay*/
+			Local_ErrStatus=EX_EEPROM_WaitWriteCycle(EX_EEPROM_SLAVE_ADDRESS(Copy_u16Address));
 		}
+		Copy_u16Address+=Local_u16ChunkLength;
+		Copy_pu8Data+=Local_u16ChunkLength;
+		Copy_u16Length-=Local_u16ChunkLength;
+	}
+	return Local_ErrStatus;
+}
+
+TWI_ErrStatus EX_EEPROMReadBlock(u16 Copy_u16Address,u8*Copy_pu8Data,u16 Copy_u16Length)
+{
+	TWI_ErrStatus Local_ErrStatus=NoError;
+	u16 Local_u16ChunkLength;
+	if((u32)Copy_u16Address+Copy_u16Length>EX_EEPROM_SIZE)
+	{
+		Local_ErrStatus=MasterReadByteErr;
 	}
-	else
+	while((Copy_u16Length!=0)&&(Local_ErrStatus==NoError))
 	{
-		Local_ErrStatus=StartCondionErr;
+		/*sequential read inside one 256 byte block, the block number is part of the slave address*/
+		Local_u16ChunkLength=EX_EEPROM_BLOCK_SIZE-(Copy_u16Address&(EX_EEPROM_BLOCK_SIZE-1));
+		if(Local_u16ChunkLength>Copy_u16Length)
+		{
+			Local_u16ChunkLength=Copy_u16Length;
+		}
+		Local_ErrStatus=TWI_ReadBurst(EX_EEPROM_SLAVE_ADDRESS(Copy_u16Address),(u8)Copy_u16Address,Copy_pu8Data,Local_u16ChunkLength);
+		Copy_u16Address+=Local_u16ChunkLength;
+		Copy_pu8Data+=Local_u16ChunkLength;
+		Copy_u16Length-=Local_u16ChunkLength;
 	}
+	return Local_ErrStatus;
 }
-void EX_EEPROMReadData(u16 Copy_u16Address,u8*Copy_u8DataByte)
+
+static TWI_ErrStatus EX_EEPROM_WaitWriteCycle(u8 Copy_u8SlaveAddress)
 {
-	TWI_SendStartCondition();
-	TWI_SendSlaveAddressWithWrite(((0XA0)|(0<<2)|(Copy_u16Address>>8)));
-	TWI_MasterWriteDataByte((u8)Copy_u16Address);
-	TWI_SendRepeatedStart();
-	TWI_SendSlaveAddressWithRead(Copy_u16Address);
-	TWI_MasterReadDataByte(Copy_u8DataByte);
-	TWI_SendStopCondition();
-}
\ No newline at end of file
+	/*the EEPROM doesn't acknowledge its address while it is programming the page*/
+	TWI_ErrStatus Local_ErrStatus=SlaveAddressWithWriteErr;
+	u16 Local_u16Counter;
+	for(Local_u16Counter=0;(Local_u16Counter<EX_EEPROM_ACK_POLL_MAX)&&(Local_ErrStatus!=NoError);Local_u16Counter++)
+	{
+		Local_ErrStatus=TWI_SendStartCondition();
+		if(Local_ErrStatus==NoError)
+		{
+			Local_ErrStatus=TWI_SendSlaveAddressWithWrite(Copy_u8SlaveAddress);
+		}
+		TWI_SendStopCondition();
+	}
+	return Local_ErrStatus;
+}
@@ -4,8 +4,19 @@
 #ifndef EX_EEPROM_CFG_H_
 #define EX_EEPROM_CFG_H_
 
+/*24C02 : size 256  page 8
+ *24C04 : size 512  page 16
+ *24C08 : size 1024 page 16
+ *24C16 : size 2048 page 16 */
+#define EX_EEPROM_SIZE          2048
+#define EX_EEPROM_PAGE_SIZE     16
 
+/*A2:A0 pins of the chip (only the pins not used as block bits), 0 if grounded*/
+#define EX_EEPROM_CHIP_ADDRESS  0x00
 
+/*max tries of the ack polling after a page write (each try is start+address+stop, about 0.1ms at 100KHz, the write cycle is 5ms max)*/
+#define EX_EEPROM_ACK_POLL_MAX  500
 
 
-#endif /* EX_EEPROM_CFG_H_ */
\ No newline at end of file
+
+#endif /* EX_EEPROM_CFG_H_ */
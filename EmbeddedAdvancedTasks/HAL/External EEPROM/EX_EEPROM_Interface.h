@@ -4,7 +4,11 @@
 
 void Ex_EEPROMInit(void);
 TWI_ErrStatus EX_EEPROMWriteData(u16 Copy_u16Address,u8 Copy_u8DataByte);
-void EX_EEPROMReadData(u16 Copy_u16Address,u8*Copy_u8DataByte);
+TWI_ErrStatus EX_EEPROMReadData(u16 Copy_u16Address,u8*Copy_u8DataByte);
+/*any length, split in page writes internally*/
+TWI_ErrStatus EX_EEPROMWriteBlock(u16 Copy_u16Address,const u8*Copy_pu8Data,u16 Copy_u16Length);
+/*any length, sequential reads*/
+TWI_ErrStatus EX_EEPROMReadBlock(u16 Copy_u16Address,u8*Copy_pu8Data,u16 Copy_u16Length);
 
 
-#endif /* EX_EEPROM_INTERFACE_H_ */
\ No newline at end of file
+#endif /* EX_EEPROM_INTERFACE_H_ */
@@ -3,8 +3,14 @@
 #ifndef EX_EEPROM_PRIVATE_H_
 #define EX_EEPROM_PRIVATE_H_
 
+/*24Cxx 7 bit address : 1010 A2 A1 A0, for 24C04:24C16 the A2:A0 bits carry
+ *the high bits of the memory address (256 byte block number)*/
+#define EX_EEPROM_BASE_ADDRESS         0x50
+#define EX_EEPROM_BLOCK_SIZE           256
+#define EX_EEPROM_SLAVE_ADDRESS(ADDRESS)  ((u8)(EX_EEPROM_BASE_ADDRESS|EX_EEPROM_CHIP_ADDRESS|(((ADDRESS)>>8)&0x07)))
 
+static TWI_ErrStatus EX_EEPROM_WaitWriteCycle(u8 Copy_u8SlaveAddress);
 
 
 
-#endif /* EX_EEPROM_PRIVATE_H_ */
\ No newline at end of file
+#endif /* EX_EEPROM_PRIVATE_H_ */
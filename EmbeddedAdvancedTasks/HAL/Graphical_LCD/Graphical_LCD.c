@@ -14,6 +14,7 @@
 #include "Utils.h"
 
 #include "DIO_Interface.h"
+#include "NumFormat_Interface.h"
 
 #include "Graphical_LCD_Interface.h"
 #include "Graphical_LCD_Private.h"
@@ -231,22 +232,15 @@ void GLCD_voidClearChar(u8 Copy_u8PageNum,u8 Copy_u8Column)
 
 void GLCD_voidWriteNumber(u8 Copy_u8PageNum,u8 Copy_u8Column,u32 Copy_u32Num)
 {
-	u8 Local_u8Counter=0,Local_u8ReminderNum,c=0;
-	u8 Num_Arr[10]={0};
-	s8 Local_u8Iterator;
+	u8 Local_u8Iterator;
+	u8 Num_Arr[NUMFORMAT_U32_SIZE];
 	GLCD_WriteIns(0xB8+Copy_u8PageNum);  // Set the page address
 	GLCD_WriteIns(0x40 +Copy_u8Column);  // Set the column address
-	while(Copy_u32Num)
-	{
-		Local_u8ReminderNum=Copy_u32Num%10;
-		Num_Arr[Local_u8Counter]=Local_u8ReminderNum;
-		Local_u8Counter++;
-		Copy_u32Num/=10;
-	}
-	for(Local_u8Iterator=Local_u8Counter-1;Local_u8Iterator>=0;Local_u8Iterator--)
+	/*"0" is written for 0*/
+	NumFormat_U32(Copy_u32Num,Num_Arr);
+	for(Local_u8Iterator=0;Num_Arr[Local_u8Iterator];Local_u8Iterator++)
 	{
-		GLCD_voidWriteChar(Copy_u8PageNum,(Copy_u8Column+((Local_u8Counter-Local_u8Iterator-1)*5)),48+Num_Arr[Local_u8Iterator]);
-		c++;
+		GLCD_voidWriteChar(Copy_u8PageNum,(Copy_u8Column+(Local_u8Iterator*5)),Num_Arr[Local_u8Iterator]);
 	}
 }
 
@@ -3,7 +3,26 @@
 #ifndef KEYPAD_PRIVATE_H_
 #define KEYPAD_PRIVATE_H_
 
+#define KEYPAD_KEYS             (ROWS*COLS)
+#define KEYPAD_SCAN_MS          (ROWS*KEYPAD_ROW_MS)
+#define KEYPAD_LONG_PRESS_SCANS (KEYPAD_LONG_PRESS_MS/KEYPAD_SCAN_MS)
+#define KEYPAD_REPEAT_SCANS     (KEYPAD_REPEAT_MS/KEYPAD_SCAN_MS)
 
+/*event in the queue : kind in the 2 high bits , key index in the low bits*/
+#define KEYPAD_EVENT_SHIFT      6
+#define KEYPAD_KEY_MASK         0x3F
+#define KEYPAD_EVENT(kind,key)  (((kind)<<KEYPAD_EVENT_SHIFT)|(key))
+
+#if KEYPAD_KEYS>(KEYPAD_KEY_MASK+1)
+#error "KEYPAD : too many keys for the event format"
+#endif
+
+#if (KEYPAD_LONG_PRESS_SCANS>255)||(KEYPAD_REPEAT_SCANS==0)
+#error "KEYPAD : long press or repeat time out of range for the scan period"
+#endif
+
+static void Keypad_ScanRow(void);
+static void Keypad_Debounce(u8 key,u8 level);
 
 
 
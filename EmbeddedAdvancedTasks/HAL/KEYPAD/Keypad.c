@@ -1,34 +1,132 @@
 #include "StdTypes.h"
 
 #include "DIO_Interface.h"
+#include "SoftTimer_Interface.h"
+#include "Queue_Interface.h"
 
 #include "Keypad_Interface.h"
 #include "Keypad_Cfg.h"
 #include "KeyPad_Private.h"
 
+static CircularQueue_type Keypad_Queue;
+static u8 Keypad_Timer;
+/*row driven low now , its columns are read on the next tick*/
+static u8 Keypad_Row=0;
+/*integrating debouncer : counts up while the key reads pressed and down while released*/
+static u8 Keypad_Integrator[KEYPAD_KEYS];
+/*debounced state of every key*/
+static u8 Keypad_Pressed[KEYPAD_KEYS];
+/*full scans since the press (or since the last repeat)*/
+static u8 Keypad_HoldScans[KEYPAD_KEYS];
+static u8 Keypad_LongPress[KEYPAD_KEYS];
 
 void Keypad_Init(void)
 {
+	u8 i;
 	for(u8 r=0;r<ROWS;r++)
 	{
 		DIO_WritePin(FIRST_OUTPUT+r,HIGH);
 	}
+	for(i=0;i<KEYPAD_KEYS;i++)
+	{
+		Keypad_Integrator[i]=0;
+		Keypad_Pressed[i]=0;
+		Keypad_HoldScans[i]=0;
+		Keypad_LongPress[i]=0;
+	}
+	CircularQueue_Init(&Keypad_Queue);
+	Keypad_Row=0;
+	DIO_WritePin(FIRST_OUTPUT,LOW);
+	SoftTimer_Create(&Keypad_Timer,Keypad_ScanRow,SOFTTIMER_PERIODIC);
+	SoftTimer_Start(Keypad_Timer,KEYPAD_ROW_MS);
+}
+
+/*the row was driven low on the previous tick so the lines had a whole tick to settle*/
+static void Keypad_ScanRow(void)
+{
+	u8 c;
+	for(c=0;c<COLS;c++)
+	{
+		Keypad_Debounce(Keypad_Row*COLS+c,DIO_ReadPin(FIRST_INPUT+c)==LOW);
+	}
+	DIO_WritePin(FIRST_OUTPUT+Keypad_Row,HIGH);
+	Keypad_Row++;
+	if(Keypad_Row==ROWS)
+	{
+		Keypad_Row=0;
+	}
+	DIO_WritePin(FIRST_OUTPUT+Keypad_Row,LOW);
 }
-u8 KEYPAD_GetKey(void)
+
+static void Keypad_Debounce(u8 key,u8 level)
 {
-	u8 r,c,key=NO_KEY;
-	for(r=0;r<ROWS;r++)
+	if(level)
 	{
-		DIO_WritePin(FIRST_OUTPUT+r,LOW);
-		for(c=0;c<COLS;c++)
+		if(Keypad_Integrator[key]<KEYPAD_DEBOUNCE_SCANS)
 		{
-			if(DIO_ReadPin(FIRST_INPUT+c)==LOW)
-			{
-				key=KeysArray[r][c];
-				while(DIO_ReadPin(FIRST_INPUT+c)==LOW);
-			}
+			Keypad_Integrator[key]++;
+		}
+	}
+	else if(Keypad_Integrator[key]>0)
+	{
+		Keypad_Integrator[key]--;
+	}
+
+	if(Keypad_Pressed[key]==0)
+	{
+		if(Keypad_Integrator[key]==KEYPAD_DEBOUNCE_SCANS)
+		{
+			Keypad_Pressed[key]=1;
+			Keypad_HoldScans[key]=0;
+			Keypad_LongPress[key]=0;
+			Enqueue(&Keypad_Queue,KEYPAD_EVENT(KEYPAD_PRESSED,key));
+		}
+	}
+	else if(Keypad_Integrator[key]==0)
+	{
+		Keypad_Pressed[key]=0;
+		Enqueue(&Keypad_Queue,KEYPAD_EVENT(KEYPAD_RELEASED,key));
+	}
+	else
+	{
+		/*held*/
+		Keypad_HoldScans[key]++;
+		if((Keypad_LongPress[key]==0)&&(Keypad_HoldScans[key]>=KEYPAD_LONG_PRESS_SCANS))
+		{
+			Keypad_LongPress[key]=1;
+			Keypad_HoldScans[key]=0;
+			Enqueue(&Keypad_Queue,KEYPAD_EVENT(KEYPAD_LONG_PRESS,key));
+		}
+		else if((Keypad_LongPress[key]==1)&&(Keypad_HoldScans[key]>=KEYPAD_REPEAT_SCANS))
+		{
+			Keypad_HoldScans[key]=0;
+			Enqueue(&Keypad_Queue,KEYPAD_EVENT(KEYPAD_REPEAT,key));
+		}
+	}
+}
+
+u8 Keypad_GetEvent(Keypad_Event_type*pevent)
+{
+	u8 event;
+	if(IsEmpty(&Keypad_Queue)==QUEUE_EMPTY)
+	{
+		return 0;
+	}
+	DeQueue(&Keypad_Queue,&event);
+	pevent->Key=KeysArray[(event&KEYPAD_KEY_MASK)/COLS][(event&KEYPAD_KEY_MASK)%COLS];
+	pevent->Kind=(Keypad_EventKind_type)(event>>KEYPAD_EVENT_SHIFT);
+	return 1;
+}
+
+u8 Keypad_GetKey(void)
+{
+	Keypad_Event_type event;
+	while(Keypad_GetEvent(&event))
+	{
+		if((event.Kind==KEYPAD_PRESSED)||(event.Kind==KEYPAD_REPEAT))
+		{
+			return event.Key;
 		}
-		DIO_WritePin(FIRST_OUTPUT+r,HIGH);
 	}
-	return key;
+	return NO_KEY;
 }
\ No newline at end of file
@@ -18,6 +18,13 @@ const u8 KeysArray[ROWS][COLS]={
 	{'c','0','=','+'}
 };
 
+/*one row is read every KEYPAD_ROW_MS , the whole keypad every ROWS*KEYPAD_ROW_MS*/
+#define KEYPAD_ROW_MS          2
+/*full scans with the same level before a key changes state (debounce time = ROWS*KEYPAD_ROW_MS*KEYPAD_DEBOUNCE_SCANS)*/
+#define KEYPAD_DEBOUNCE_SCANS  3
+#define KEYPAD_LONG_PRESS_MS   800
+#define KEYPAD_REPEAT_MS       200
+
 
 
 #endif /* KEYPAD_CFG_H_ */
\ No newline at end of file
@@ -4,7 +4,28 @@
 
 #define NO_KEY  'T'
 
+typedef enum{
+	KEYPAD_PRESSED=0,
+	KEYPAD_RELEASED,
+	KEYPAD_LONG_PRESS,   /*key held for KEYPAD_LONG_PRESS_MS*/
+	KEYPAD_REPEAT        /*every KEYPAD_REPEAT_MS after the long press while the key is held*/
+	}Keypad_EventKind_type;
+
+typedef struct{
+	u8 Key;              /*character from KeysArray*/
+	Keypad_EventKind_type Kind;
+	}Keypad_Event_type;
+
+/*the keypad is scanned one row per soft timer tick, nothing blocks
+ *you need to init the soft timers first and call SoftTimer_Dispatch in the main loop
+ *SysTime_Init();
+ *SoftTimer_Init();
+ *GLOBAL_ENABLE();
+ */
 void Keypad_Init(void);
+/*oldest key event , 0 if there is no event*/
+u8 Keypad_GetEvent(Keypad_Event_type*pevent);
+/*key of the next press (or repeat) event , NO_KEY if there is none. never waits for the release*/
 u8 Keypad_GetKey(void);
 
 
@@ -1,15 +1,38 @@
+#include <stdarg.h>
 #include "StdTypes.h"
 #include "Utils.h"
 
 #include "DIO_Interface.h"
+#include "NumFormat_Interface.h"
 
 #include "LCD_Interface.h"
 #include "LCD_Cfg.h"
 #include "LCD_Private.h"
 
-#define F_CPU  8000000
+#define F_CPU  8000000
 #include <util/delay.h>
 
+/*Shadow buffer : the application writes in RAM, LCD_Refresh sends the changed cells*/
+static u8 LCD_Shadow[LCD_LINES*LCD_CELLS];
+/*what the LCD is showing now*/
+static u8 LCD_Screen[LCD_LINES*LCD_CELLS];
+static u8 LCD_BufferLine=0;
+static u8 LCD_BufferCell=0;
+static u8 LCD_RefreshIndex=0;
+/*cell of the LCD address counter, LCD_UNKNOWN_ADDRESS after a direct write*/
+static u8 LCD_Address=LCD_UNKNOWN_ADDRESS;
+/*set at the end of LCD_Init, the busy flag is only read after that*/
+static u8 LCD_Ready=0;
+
+/*Enable pulse and execution times from the HD44780 data sheet (EN high >=450ns , 37us per instruction)*/
+static void LCD_Pulse(void)
+{
+	DIO_WritePin(EN,HIGH);
+	_delay_us(LCD_EN_PULSE_US);
+	DIO_WritePin(EN,LOW);
+	_delay_us(LCD_EN_PULSE_US);
+}
+
 #if LCD_MODE==_8_BIT
 void LCD_Init(void)
 {
@@ -30,38 +53,59 @@ void LCD_Init(void)
 	LCD_WriteIns(0x0c); //0x0e  ,  0x0f
 	/*Display Clear*/
 	LCD_WriteIns(0x01); //clear screen
-	_delay_ms(1);
 	/*Entry mode set
 	*I/D: (1) increase and (0) decrease 
 	*S:shift (1) shift to left and (0) shift to write 
 	* i will set 0x00000110 (0x06) I/D increase and shift to right */
 	LCD_WriteIns(0x06);
+	LCD_ShadowInit();
+	LCD_Ready=1;
 }
-static void LCD_WriteIns(u8 ins)
+static void LCD_WriteBus(u8 value)
 {
-	DIO_WritePin(RS,LOW);
-	DIO_WritePort(LCD_PORT,ins); 
-	DIO_WritePin(EN,HIGH);
-	_delay_ms(1);
-	DIO_WritePin(EN,LOW);
-	_delay_ms(1);
+	DIO_WritePort(LCD_PORT,value);
+	LCD_Pulse();
 }
-static void LCD_WriteData(u8 data)
+#if LCD_TIMING==LCD_TIMING_BUSY_FLAG
+static u8 LCD_ReadBusyFlag(void)
 {
-	DIO_WritePin(RS,HIGH);
-	DIO_WritePort(LCD_PORT,data); 
+	u8 i,busy;
+	for(i=0;i<8;i++)
+	{
+		DIO_SetPinStatus(LCD_PORT*8+i,INFREE);
+	}
+	DIO_WritePin(RS,LOW);
+	DIO_WritePin(RW,HIGH);
 	DIO_WritePin(EN,HIGH);
-	_delay_ms(1);
+	_delay_us(LCD_EN_PULSE_US);
+	busy=READ_BIT(DIO_ReadPort(LCD_PORT),7);
 	DIO_WritePin(EN,LOW);
-	_delay_ms(1);
+	DIO_WritePin(RW,LOW);
+	for(i=0;i<8;i++)
+	{
+		DIO_SetPinStatus(LCD_PORT*8+i,OUTPUT);
+	}
+	return busy;
 }
+#endif
 #elif LCD_MODE==_4_BIT
 void LCD_Init(void)
 {
 	/* 8-Bit Initialization */
 	_delay_ms(50);
-	/*send the high part*/
-	LCD_WriteIns(0x02);
+	/*the LCD starts in 8 bit mode where every nibble is a full instruction (37us at least),
+	 *so the switch to 4 bit is done one nibble at a time with the data sheet waits
+	 *in both timing modes (the busy flag can't be read yet)*/
+	DIO_WritePin(RS,LOW);
+	LCD_WriteInitNibble(0x3);
+	_delay_ms(LCD_INIT_WAIT1_MS);
+	LCD_WriteInitNibble(0x3);
+	_delay_us(LCD_INIT_WAIT2_US);
+	LCD_WriteInitNibble(0x3);
+	_delay_us(LCD_EXECUTION_US);
+	/*4 bit mode from here , every instruction is 2 nibbles*/
+	LCD_WriteInitNibble(0x2);
+	_delay_us(LCD_EXECUTION_US);
 	/*Function Set
 	*DL:set data length (0) 4-bit mode and (1) 8-bit mode
 	*N:set number of lines (0) 1 line and (1) 2 line
@@ -77,54 +121,116 @@ void LCD_Init(void)
 	LCD_WriteIns(0x0c); //0x0e  ,  0x0f
 	/*Display Clear*/
 	LCD_WriteIns(0x01); //clear screen
-	_delay_ms(1);
 	/*Entry mode set
 	*I/D: (1) increase and (0) decrease 
 	*S:shift (1) shift to left and (0) shift to write 
 	* i will set 0x00000110 (0x06) I/D increase and shift to right */
 	LCD_WriteIns(0x06);
+	LCD_ShadowInit();
+	LCD_Ready=1;
 }
-static void LCD_WriteIns(u8 ins)
+static void LCD_WriteInitNibble(u8 nibble)
+{
+	DIO_WritePin(D7,READ_BIT(nibble,3));
+	DIO_WritePin(D6,READ_BIT(nibble,2));
+	DIO_WritePin(D5,READ_BIT(nibble,1));
+	DIO_WritePin(D4,READ_BIT(nibble,0));
+	LCD_Pulse();
+}
+static void LCD_WriteBus(u8 value)
 {
+	DIO_WritePin(D7,READ_BIT(value,7));
+	DIO_WritePin(D6,READ_BIT(value,6));
+	DIO_WritePin(D5,READ_BIT(value,5));
+	DIO_WritePin(D4,READ_BIT(value,4));
+	LCD_Pulse();
+	DIO_WritePin(D7,READ_BIT(value,3));
+	DIO_WritePin(D6,READ_BIT(value,2));
+	DIO_WritePin(D5,READ_BIT(value,1));
+	DIO_WritePin(D4,READ_BIT(value,0));
+	LCD_Pulse();
+}
+#if LCD_TIMING==LCD_TIMING_BUSY_FLAG
+static u8 LCD_ReadBusyFlag(void)
+{
+	u8 busy;
+	DIO_SetPinStatus(D7,INFREE);
+	DIO_SetPinStatus(D6,INFREE);
+	DIO_SetPinStatus(D5,INFREE);
+	DIO_SetPinStatus(D4,INFREE);
 	DIO_WritePin(RS,LOW);
-	DIO_WritePin(D7,READ_BIT(ins,7));
-	DIO_WritePin(D6,READ_BIT(ins,6));
-	DIO_WritePin(D5,READ_BIT(ins,5));
-	DIO_WritePin(D4,READ_BIT(ins,4));
-	DIO_WritePin(EN,HIGH);
-	_delay_ms(1);
-	DIO_WritePin(EN,LOW);
-	_delay_ms(1);
-	DIO_WritePin(D7,READ_BIT(ins,3));
-	DIO_WritePin(D6,READ_BIT(ins,2));
-	DIO_WritePin(D5,READ_BIT(ins,1));
-	DIO_WritePin(D4,READ_BIT(ins,0));
+	DIO_WritePin(RW,HIGH);
+	/*BF is bit 7 in the high nibble, the low nibble (address counter) must be read too*/
 	DIO_WritePin(EN,HIGH);
-	_delay_ms(1);
+	_delay_us(LCD_EN_PULSE_US);
+	busy=DIO_ReadPin(D7);
 	DIO_WritePin(EN,LOW);
-	_delay_ms(1);
+	_delay_us(LCD_EN_PULSE_US);
+	LCD_Pulse();
+	DIO_WritePin(RW,LOW);
+	DIO_SetPinStatus(D7,OUTPUT);
+	DIO_SetPinStatus(D6,OUTPUT);
+	DIO_SetPinStatus(D5,OUTPUT);
+	DIO_SetPinStatus(D4,OUTPUT);
+	return busy;
+}
+#endif
+#endif
+
+#if LCD_TIMING==LCD_TIMING_BUSY_FLAG
+/*wait the end of the last instruction, the busy flag can't be used before the function set of LCD_Init*/
+static void LCD_WaitReady(void)
+{
+	u16 timeout=LCD_BUSY_TIMEOUT;
+	if(LCD_Ready)
+	{
+		while(LCD_ReadBusyFlag()&&timeout)
+		{
+			timeout--;
+		}
+	}
+	else
+	{
+		_delay_ms(LCD_CLEAR_MS);
+	}
+}
+static void LCD_WaitExecution(u8 ins)
+{
+	/*nothing to wait here, the next write polls the busy flag*/
+	(void)ins;
+}
+#else
+static void LCD_WaitReady(void)
+{
+}
+static void LCD_WaitExecution(u8 ins)
+{
+	/*clear display and return home take 1.52ms , the others 37us*/
+	if(ins<=LCD_RETURN_HOME)
+	{
+		_delay_ms(LCD_CLEAR_MS);
+	}
+	else
+	{
+		_delay_us(LCD_EXECUTION_US);
+	}
+}
+#endif
+
+static void LCD_WriteIns(u8 ins)
+{
+	LCD_WaitReady();
+	DIO_WritePin(RS,LOW);
+	LCD_WriteBus(ins);
+	LCD_WaitExecution(ins);
 }
 static void LCD_WriteData(u8 data)
 {
+	LCD_WaitReady();
 	DIO_WritePin(RS,HIGH);
-	DIO_WritePin(D7,READ_BIT(data,7));
-	DIO_WritePin(D6,READ_BIT(data,6));
-	DIO_WritePin(D5,READ_BIT(data,5));
-	DIO_WritePin(D4,READ_BIT(data,4));
-	DIO_WritePin(EN,HIGH);
-	_delay_ms(1);
-	DIO_WritePin(EN,LOW);
-	_delay_ms(1);
-	DIO_WritePin(D7,READ_BIT(data,3));
-	DIO_WritePin(D6,READ_BIT(data,2));
-	DIO_WritePin(D5,READ_BIT(data,1));
-	DIO_WritePin(D4,READ_BIT(data,0));
-	DIO_WritePin(EN,HIGH);
-	_delay_ms(1);
-	DIO_WritePin(EN,LOW);
-	_delay_ms(1);
+	LCD_WriteBus(data);
+	LCD_WaitExecution(LCD_DATA_WRITE);
 }
-#endif
 
 
 
@@ -167,27 +273,9 @@ void LCD_SetCurser(u8 line ,u8 cell)
 }
 void LCD_WriteNumber(s32 num)
 {
-	u8 arr[20],i=0;
-	s8 j;
-	if(num<0)
-	{
-		LCD_WriteChar('-');
-		num=num*(-1);
-	}
-	if(num==0)
-	{
-		LCD_WriteChar('0');
-	}
-	while(num)
-	{
-		arr[i]=num%10+'0';
-		num=num/10;
-		i++;
-	}
-	for(j=i-1;j>=0;j--)
-	{
-		LCD_WriteChar(arr[j]);
-	}
+	u8 arr[NUMFORMAT_S32_SIZE];
+	NumFormat_S32(num,arr);
+	LCD_WriteString(arr);
 }
 void LCD_WriteBinary(u8 num)
 {
@@ -255,10 +343,9 @@ void LCD_Clear(void)
 
 void LCD_WriteNumber_4D(u16 num)
 {
-	LCD_WriteChar(((num%10000)/1000)+'0');
-	LCD_WriteChar(((num%1000)/100)+'0');
-	LCD_WriteChar(((num%100)/10)+'0');
-	LCD_WriteChar(((num%10)/1)+'0');
+	u8 arr[5];
+	NumFormat_U32Digits(num,4,arr);
+	LCD_WriteString(arr);
 }
 
 void LCD_CustomChar(u8 loc,u8*pattern)
@@ -269,4 +356,164 @@ void LCD_CustomChar(u8 loc,u8*pattern)
 		LCD_WriteChar(pattern[i]);
 	}
 	LCD_WriteIns(0x80);
+}
+
+/***************************************Shadow buffer***************************************/
+/*the display is cleared by LCD_Init, both buffers start with spaces*/
+static void LCD_ShadowInit(void)
+{
+	u8 i;
+	for(i=0;i<LCD_LINES*LCD_CELLS;i++)
+	{
+		LCD_Shadow[i]=' ';
+		LCD_Screen[i]=' ';
+	}
+	LCD_BufferLine=0;
+	LCD_BufferCell=0;
+	LCD_RefreshIndex=0;
+	LCD_Address=LCD_UNKNOWN_ADDRESS;
+}
+
+void LCD_BufferClear(void)
+{
+	u8 i;
+	for(i=0;i<LCD_LINES*LCD_CELLS;i++)
+	{
+		LCD_Shadow[i]=' ';
+	}
+	LCD_BufferLine=0;
+	LCD_BufferCell=0;
+}
+
+void LCD_BufferSetCurser(u8 line ,u8 cell)
+{
+	if((line<LCD_LINES)&&(cell<LCD_CELLS))
+	{
+		LCD_BufferLine=line;
+		LCD_BufferCell=cell;
+	}
+}
+
+void LCD_BufferWriteChar(u8 ch)
+{
+	if(ch=='\n')
+	{
+		/*start of the next line (back to the first line after the last one)*/
+		LCD_BufferCell=0;
+		LCD_BufferLine++;
+		if(LCD_BufferLine==LCD_LINES)
+		{
+			LCD_BufferLine=0;
+		}
+	}
+	else if(LCD_BufferCell<LCD_CELLS)
+	{
+		/*the characters after the end of the line are dropped*/
+		LCD_Shadow[LCD_BufferLine*LCD_CELLS+LCD_BufferCell]=ch;
+		LCD_BufferCell++;
+	}
+}
+
+void LCD_BufferWriteString(const char*str)
+{
+	u8 i;
+	for(i=0;str[i];i++)
+	{
+		LCD_BufferWriteChar(str[i]);
+	}
+}
+
+
+/*%c %s %d %u %x (int) , %ld %lu %lx (long) and %% , no width and no float*/
+void LCD_Printf(const char*format,...)
+{
+	va_list args;
+	u8 Local_u8Long;
+	u8 Local_au8Number[NUMFORMAT_S32_SIZE];
+	va_start(args,format);
+	for(;*format;format++)
+	{
+		if(*format!='%')
+		{
+			LCD_BufferWriteChar(*format);
+			continue;
+		}
+		format++;
+		Local_u8Long=0;
+		if(*format=='l')
+		{
+			Local_u8Long=1;
+			format++;
+		}
+		switch(*format)
+		{
+			case 'c':
+			LCD_BufferWriteChar((u8)va_arg(args,int));
+			break;
+			case 's':
+			LCD_BufferWriteString(va_arg(args,const char*));
+			break;
+			case 'd':
+			NumFormat_S32(Local_u8Long?va_arg(args,s32):va_arg(args,int),Local_au8Number);
+			LCD_BufferWriteString((const char*)Local_au8Number);
+			break;
+			case 'u':
+			NumFormat_U32(Local_u8Long?va_arg(args,u32):va_arg(args,unsigned int),Local_au8Number);
+			LCD_BufferWriteString((const char*)Local_au8Number);
+			break;
+			case 'x':
+			NumFormat_Hex(Local_u8Long?va_arg(args,u32):va_arg(args,unsigned int),0,Local_au8Number);
+			LCD_BufferWriteString((const char*)Local_au8Number);
+			break;
+			case '%':
+			LCD_BufferWriteChar('%');
+			break;
+			case 0:
+			/*'%' at the end of the format*/
+			format--;
+			break;
+			default:
+			break;
+		}
+	}
+	va_end(args);
+}
+
+/*sends at most LCD_REFRESH_CHARS changed cells, call it from a periodic soft timer*/
+void LCD_Refresh(void)
+{
+	u8 Local_u8Sent=0,Local_u8Checked;
+	for(Local_u8Checked=0;(Local_u8Checked<LCD_LINES*LCD_CELLS)&&(Local_u8Sent<LCD_REFRESH_CHARS);Local_u8Checked++)
+	{
+		if(LCD_Shadow[LCD_RefreshIndex]!=LCD_Screen[LCD_RefreshIndex])
+		{
+			/*the address counter follows the writes inside a line only*/
+			if(LCD_Address!=LCD_RefreshIndex)
+			{
+				LCD_SetCurser(LCD_RefreshIndex/LCD_CELLS,LCD_RefreshIndex%LCD_CELLS);
+			}
+			LCD_WriteData(LCD_Shadow[LCD_RefreshIndex]);
+			LCD_Screen[LCD_RefreshIndex]=LCD_Shadow[LCD_RefreshIndex];
+			LCD_Address=((LCD_RefreshIndex+1)%LCD_CELLS)?(LCD_RefreshIndex+1):LCD_UNKNOWN_ADDRESS;
+			Local_u8Sent++;
+		}
+		LCD_RefreshIndex++;
+		if(LCD_RefreshIndex==LCD_LINES*LCD_CELLS)
+		{
+			LCD_RefreshIndex=0;
+		}
+	}
+}
+
+u8 LCD_IsRefreshDone(void)
+{
+	u8 i;
+	for(i=0;i<LCD_LINES*LCD_CELLS;i++)
+	{
+		if(LCD_Shadow[i]!=LCD_Screen[i])
+		{
+			return 0;
+		}
+	}
+	return 1;
 }
\ No newline at end of file
@@ -19,6 +19,17 @@
 #define RS  PINA1
 #define EN  PINA2
 
+/******** LCD_TIMING_DELAY or LCD_TIMING_BUSY_FLAG ********
+ *LCD_TIMING_DELAY     : RW tied to GND, fixed data sheet delays after every write
+ *LCD_TIMING_BUSY_FLAG : RW on a pin, the busy flag is polled before every write*/
+#define LCD_TIMING   LCD_TIMING_DELAY
+#define RW  PINA7
+
+/*Shadow buffer size and number of changed cells sent by every LCD_Refresh*/
+#define LCD_LINES          2
+#define LCD_CELLS          16
+#define LCD_REFRESH_CHARS  4
+
 
 
 #endif /* LCD_CFG_H_ */
\ No newline at end of file
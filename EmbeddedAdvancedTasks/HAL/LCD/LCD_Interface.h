@@ -14,5 +14,16 @@ void LCD_Clear(void);
 void LCD_CustomChar(u8 loc,u8*pattern);
 void LCD_WriteHexa_Method2(u8 num);
 
+/*Shadow buffer : writes go to RAM and never wait the LCD
+ *LCD_Refresh sends a few changed cells per call (run it from a periodic soft timer)
+ *don't mix with the direct write functions above after LCD_Init*/
+void LCD_BufferClear(void);
+void LCD_BufferSetCurser(u8 line ,u8 cell);
+void LCD_BufferWriteChar(u8 ch);
+void LCD_BufferWriteString(const char*str);
+void LCD_Printf(const char*format,...);
+void LCD_Refresh(void);
+u8 LCD_IsRefreshDone(void);
+
 
 #endif /* LCD_INTERFACE_H_ */
\ No newline at end of file
@@ -6,8 +6,37 @@
 #define _4_BIT  0
 #define _8_BIT 1
 
+#define LCD_TIMING_DELAY       0
+#define LCD_TIMING_BUSY_FLAG   1
+
+/*HD44780 timing : EN pulse >=450ns , 37us per instruction (40 with margin) , clear and home 1.52ms*/
+#define LCD_EN_PULSE_US        1
+#define LCD_EXECUTION_US       40
+#define LCD_CLEAR_MS           2
+/*4 bit init by instruction (data sheet figure 24) : waits after the first and second 0x3 nibbles*/
+#define LCD_INIT_WAIT1_MS      5
+#define LCD_INIT_WAIT2_US      100
+/*instructions 0x01 (clear) , 0x02 and 0x03 (return home) need the long time*/
+#define LCD_RETURN_HOME        0x03
+#define LCD_DATA_WRITE         0xFF
+/*busy flag reads before giving up (LCD not connected)*/
+#define LCD_BUSY_TIMEOUT       1000
+
 static void LCD_WriteIns(u8 ins);
 static void LCD_WriteData(u8 data);
+static void LCD_Pulse(void);
+static void LCD_WriteBus(u8 value);
+#if LCD_MODE==_4_BIT
+static void LCD_WriteInitNibble(u8 nibble);
+#endif
+static void LCD_WaitReady(void);
+static void LCD_WaitExecution(u8 ins);
+#if LCD_TIMING==LCD_TIMING_BUSY_FLAG
+static u8 LCD_ReadBusyFlag(void);
+#endif
+static void LCD_ShadowInit(void);
+
+#define LCD_UNKNOWN_ADDRESS  0xFF
 
 
 
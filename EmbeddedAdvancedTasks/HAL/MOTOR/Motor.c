@@ -1,27 +1,206 @@
 
 #include "StdTypes.h"
+#include "MemMap.h"
 /*Includes From MCAL*/
 #include "DIO_Interface.h"
+#include "Timer_Interface.h"
 /*Includes From HAL*/
 #include "Motor_Interface.h"
 #include "Motor_Cfg.h"
+#include "Motor_Private.h"
+
+/*the ramps run in the PWM overflow ISR , the main loop reads and writes the speeds with the interrupts off*/
+static volatile s16 Motor_Target[NUMBER_MOTORS];
+static volatile s16 Motor_Speed[NUMBER_MOTORS];
+/*direction pins (IN1|IN2) of all the motors in every port*/
+static u8 Motor_DirectionMask[MOTOR_PORTS];
+static u8 Motor_Overflows=0;
+/*1 once a PWM timer overflow runs the ramps*/
+static u8 Motor_Ramping=0;
 
 void Motor_Init()
 {
-	
+	u8 motor;
+	Motor_Ramping=0;
+	Motor_Overflows=0;
+	for(motor=0;motor<NUMBER_MOTORS;motor++)
+	{
+		Motor_Target[motor]=0;
+		Motor_Speed[motor]=0;
+		Motor_DirectionMask[MOTOR_PORT(MotorPinsArray[motor][IN1])]|=1<<MOTOR_BIT(MotorPinsArray[motor][IN1]);
+		Motor_DirectionMask[MOTOR_PORT(MotorPinsArray[motor][IN2])]|=1<<MOTOR_BIT(MotorPinsArray[motor][IN2]);
+		MOTOR_SetDuty(motor,0);
+		switch(MotorPwmArray[motor])
+		{
+			case MOTOR_PWM_OC0:
+			TIMER0_Init(TIMER0_FASTPWM_MODE,MOTOR_PWM_SCALER0);
+			TIMER0_OC0Mode(OC0_NON_INVERTING);
+			if(Motor_Ramping==0)
+			{
+				TIMER0_OV_SetCallBack(MOTOR_PwmOverflow);
+				TIMER0_OV_InterruptEnable();
+				Motor_Ramping=1;
+			}
+			break;
+			case MOTOR_PWM_OC1A:
+			case MOTOR_PWM_OC1B:
+			ICR1=MOTOR_PWM_TOP;
+			Timer1_Init(TIMER1_FASTPWM_ICR_TOP_MODE,MOTOR_PWM_SCALER1);
+			if(MotorPwmArray[motor]==MOTOR_PWM_OC1A)
+			{
+				Timer1_OCRA1Mode(OCRA_NON_INVERTING);
+			}
+			else
+			{
+				Timer1_OCRB1Mode(OCRB_NON_INVERTING);
+			}
+			if(Motor_Ramping==0)
+			{
+				/*overflow at ICR1 , the same 256 counts period as Timer0 and Timer2*/
+				Timer1_OVF_SetCallBack(MOTOR_PwmOverflow);
+				Timer1_OVF_InterruptEnable();
+				Motor_Ramping=1;
+			}
+			break;
+			case MOTOR_PWM_OC2:
+			TIMER2_Init(TIMER2_FASTPWM_MODE,MOTOR_PWM_SCALER2);
+			TIMER2_OC0Mode(OCR2_NON_INVERTING);
+			if(Motor_Ramping==0)
+			{
+				TIMER2_OV_SetCallBack(MOTOR_PwmOverflow);
+				TIMER2_OV_InterruptEnable();
+				Motor_Ramping=1;
+			}
+			break;
+			case MOTOR_PWM_NONE:
+			break;
+		}
+	}
 }
 void MOTOR_Stop(MOTOR_type motor)
 {
-	DIO_WritePin(MotorPinsArray[motor][IN1],LOW);
-	DIO_WritePin(MotorPinsArray[motor][IN2],LOW);
+	MOTOR_SetSpeed(motor,0);
 }
 void MOTOR_CW(MOTOR_type motor)
 {
-	DIO_WritePin(MotorPinsArray[motor][IN1],HIGH);
-	DIO_WritePin(MotorPinsArray[motor][IN2],LOW);
+	MOTOR_SetSpeed(motor,MOTOR_MAX_SPEED);
 }
 void MOTOR_CCW(MOTOR_type motor)
 {
-	DIO_WritePin(MotorPinsArray[motor][IN1],LOW);
-	DIO_WritePin(MotorPinsArray[motor][IN2],HIGH);
+	MOTOR_SetSpeed(motor,-MOTOR_MAX_SPEED);
+}
+
+void MOTOR_SetSpeed(MOTOR_type motor,s16 speed)
+{
+	u8 sreg;
+	if(motor<NUMBER_MOTORS)
+	{
+		if(speed>MOTOR_MAX_SPEED)
+		{
+			speed=MOTOR_MAX_SPEED;
+		}
+		else if(speed<-MOTOR_MAX_SPEED)
+		{
+			speed=-MOTOR_MAX_SPEED;
+		}
+		sreg=SREG;
+		cli();
+		Motor_Target[motor]=speed;
+		if(Motor_Ramping==0)
+		{
+			/*no PWM timer to run the ramps , the tick applies the new speed at once*/
+			Motor_Speed[motor]=speed;
+			MOTOR_RampTick();
+		}
+		SREG=sreg;
+	}
+}
+
+s16 MOTOR_GetSpeed(MOTOR_type motor)
+{
+	s16 speed=0;
+	u8 sreg;
+	if(motor<NUMBER_MOTORS)
+	{
+		sreg=SREG;
+		cli();
+		speed=Motor_Speed[motor];
+		SREG=sreg;
+	}
+	return speed;
+}
+
+/*overflow of a PWM timer , one ramp tick every MOTOR_TICK_OVERFLOWS PWM periods*/
+static void MOTOR_PwmOverflow(void)
+{
+	Motor_Overflows++;
+	if(Motor_Overflows>=MOTOR_TICK_OVERFLOWS)
+	{
+		Motor_Overflows=0;
+		MOTOR_RampTick();
+	}
+}
+
+/*every MOTOR_TICK_MS : all the speeds move one step , then one masked write per port for the directions*/
+static void MOTOR_RampTick(void)
+{
+	u8 motor,port;
+	u8 direction[MOTOR_PORTS]={0};
+	s16 target;
+	for(motor=0;motor<NUMBER_MOTORS;motor++)
+	{
+		target=Motor_Target[motor];
+		if(Motor_Speed[motor]<target)
+		{
+			Motor_Speed[motor]=((target-Motor_Speed[motor])>MOTOR_RAMP_STEP)?(Motor_Speed[motor]+MOTOR_RAMP_STEP):target;
+		}
+		else if(Motor_Speed[motor]>target)
+		{
+			Motor_Speed[motor]=((Motor_Speed[motor]-target)>MOTOR_RAMP_STEP)?(Motor_Speed[motor]-MOTOR_RAMP_STEP):target;
+		}
+		/*the speed goes through 0 on a reverse , both pins are LOW there*/
+		if(Motor_Speed[motor]>0)
+		{
+			direction[MOTOR_PORT(MotorPinsArray[motor][IN1])]|=1<<MOTOR_BIT(MotorPinsArray[motor][IN1]);
+			MOTOR_SetDuty(motor,(u8)Motor_Speed[motor]);
+		}
+		else if(Motor_Speed[motor]<0)
+		{
+			direction[MOTOR_PORT(MotorPinsArray[motor][IN2])]|=1<<MOTOR_BIT(MotorPinsArray[motor][IN2]);
+			MOTOR_SetDuty(motor,(u8)(-Motor_Speed[motor]));
+		}
+		else
+		{
+			MOTOR_SetDuty(motor,0);
+		}
+	}
+	for(port=0;port<MOTOR_PORTS;port++)
+	{
+		if(Motor_DirectionMask[port])
+		{
+			DIO_WritePortMasked((DIO_Port_type)port,Motor_DirectionMask[port],direction[port]);
+		}
+	}
+}
+
+static void MOTOR_SetDuty(MOTOR_type motor,u8 duty)
+{
+	switch(MotorPwmArray[motor])
+	{
+		case MOTOR_PWM_OC0:
+		OCR0=duty;
+		break;
+		case MOTOR_PWM_OC1A:
+		OCR1A=duty;
+		break;
+		case MOTOR_PWM_OC1B:
+		OCR1B=duty;
+		break;
+		case MOTOR_PWM_OC2:
+		OCR2=duty;
+		break;
+		case MOTOR_PWM_NONE:
+		DIO_WritePin(MotorPinsArray[motor][EN],duty?HIGH:LOW);
+		break;
+	}
 }
\ No newline at end of file
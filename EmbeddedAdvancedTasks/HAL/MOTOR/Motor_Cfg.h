@@ -3,22 +3,24 @@
 #define MOTOR_CFG_H_
 
 /*********************************Pin Config*********************************/
+/*EN must be the pin of the compare output in MotorPwmArray (set as OUTPUT in DIO)
+ *or any output pin for MOTOR_PWM_NONE*/
 /*M1*/
 #define M1_IN1   PINA0
 #define M1_IN2   PINA1
-#define M1_EN    PINA1
+#define M1_EN    PINB3
 /*M2*/
-#define M2_IN1   PINA0
-#define M2_IN2   PINA1
-#define M2_EN    PINA1
+#define M2_IN1   PINA2
+#define M2_IN2   PINA3
+#define M2_EN    PIND7
 /*M3*/
-#define M3_IN1   PINA0
-#define M3_IN2   PINA1
-#define M3_EN    PINA1
+#define M3_IN1   PINA4
+#define M3_IN2   PINA5
+#define M3_EN    PIND4
 /*M4*/
-#define M4_IN1   PINA0
-#define M4_IN2   PINA1
-#define M4_EN    PINA1
+#define M4_IN1   PINA6
+#define M4_IN2   PINA7
+#define M4_EN    PIND5
 /*********************************Config Method*********************************/
 #define METHOD_TYPE   0
 #if METHOD_TYPE==1
@@ -44,4 +46,25 @@ DIO_Pin_type MotorPinsArray[NUMBER_MOTORS][MOTOR_PIN_NUMBERS]={
 };
 #endif
 
+/*Timer1 is kept for SysTime/SoftTimer : M3 and M4 are on/off , use MOTOR_PWM_OC1A/OC1B
+ *for them only in an application without SysTime , SoftTimer and Ultrasonic*/
+MOTOR_Pwm_type MotorPwmArray[NUMBER_MOTORS]={
+	/*MOTOR_1*/MOTOR_PWM_OC0,
+	/*MOTOR_2*/MOTOR_PWM_OC2,
+	/*MOTOR_3*/MOTOR_PWM_NONE,
+	/*MOTOR_4*/MOTOR_PWM_NONE
+};
+
+/*********************************PWM and ramps*********************************/
+/*8MHz/8/256 --> 3.9KHz PWM on all the timers , one overflow every 256us
+ *MOTOR_PWM_PRESCALER is the prescaler of the 3 scalers (they must be the same)*/
+#define MOTOR_PWM_SCALER0   TIMER0_SCALER_8
+#define MOTOR_PWM_SCALER1   TIMER1_SCALER_8
+#define MOTOR_PWM_SCALER2   TIMER2_SCALER_8
+#define MOTOR_PWM_PRESCALER 8
+/*the speed moves MOTOR_RAMP_STEP toward the target every MOTOR_TICK_MS (rounded to whole PWM periods)
+ *0 to MOTOR_MAX_SPEED in 255/15*10ms=170ms*/
+#define MOTOR_TICK_MS       10
+#define MOTOR_RAMP_STEP     15
+
 #endif /* MOTOR_CFG_H_ */
\ No newline at end of file
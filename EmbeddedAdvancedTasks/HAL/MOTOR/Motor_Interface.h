@@ -16,10 +16,35 @@ typedef enum{
 	NUMBER_MOTORS
 }MOTOR_type;
 
+/*compare output driving the EN pin of a motor
+ *OC1A/OC1B put Timer1 in fast PWM : they can't be used with SysTime , SoftTimer or Ultrasonic
+ *which need Timer1 counting in normal mode (and OCR1A/OCR1B as their own compares)*/
+typedef enum{
+	MOTOR_PWM_OC0=0,     /*PINB3*/
+	MOTOR_PWM_OC1A,      /*PIND5*/
+	MOTOR_PWM_OC1B,      /*PIND4*/
+	MOTOR_PWM_OC2,       /*PIND7*/
+	MOTOR_PWM_NONE       /*EN on any DIO pin , on/off only (full speed while the speed is not 0)*/
+}MOTOR_Pwm_type;
+
+/*full speed , the duty is speed/MOTOR_MAX_SPEED*/
+#define MOTOR_MAX_SPEED    255
+
+/*starts the PWM of the motors , only the timers of the outputs in MotorPwmArray are used :
+ *Timer0 (OC0 , also used by the 7-segment and RGB) , Timer1 (OC1A/OC1B , fast PWM ICR1 top)
+ *and Timer2 (OC2 , also used by Supervisor and the RTC)
+ *the ramps run in the overflow interrupt of the PWM timer of the first PWM motor ,
+ *without any PWM motor the speed is applied at once
+ *GLOBAL_ENABLE();*/
 void Motor_Init(void);
+/*ramps to 0 , MOTOR_MAX_SPEED and -MOTOR_MAX_SPEED*/
 void MOTOR_Stop(MOTOR_type motor);
 void MOTOR_CW(MOTOR_type motor);
 void MOTOR_CCW(MOTOR_type motor);
+/*target speed -MOTOR_MAX_SPEED:MOTOR_MAX_SPEED (>0 CW , <0 CCW) , reached with MOTOR_RAMP_STEP per tick*/
+void MOTOR_SetSpeed(MOTOR_type motor,s16 speed);
+/*speed applied now (on the way of the ramp)*/
+s16 MOTOR_GetSpeed(MOTOR_type motor);
 
 
 
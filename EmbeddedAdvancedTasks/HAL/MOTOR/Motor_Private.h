@@ -0,0 +1,25 @@
+
+
+#ifndef MOTOR_PRIVATE_H_
+#define MOTOR_PRIVATE_H_
+
+#define MOTOR_PORTS          4
+#define MOTOR_PORT(pin)      ((pin)>>3)
+#define MOTOR_BIT(pin)       ((pin)&7)
+/*ICR1 top so OCR1A and OCR1B are both 8 bit duties like OCR0 and OCR2*/
+#define MOTOR_PWM_TOP        MOTOR_MAX_SPEED
+/*PWM overflows in one ramp tick , rounded*/
+#define MOTOR_PWM_PERIOD_COUNTS  (MOTOR_PWM_PRESCALER*(MOTOR_PWM_TOP+1UL))
+#define MOTOR_TICK_OVERFLOWS ((MOTOR_TICK_MS*1000UL*TIMER_CLOCK_MHZ+(MOTOR_PWM_PERIOD_COUNTS/2))/MOTOR_PWM_PERIOD_COUNTS)
+
+#if MOTOR_TICK_OVERFLOWS==0 || MOTOR_TICK_OVERFLOWS>255
+#error "MOTOR_TICK_MS must be 1:255 periods of the PWM"
+#endif
+
+static void MOTOR_PwmOverflow(void);
+static void MOTOR_RampTick(void);
+static void MOTOR_SetDuty(MOTOR_type motor,u8 duty);
+
+
+
+#endif /* MOTOR_PRIVATE_H_ */
\ No newline at end of file
@@ -1,23 +1,43 @@
 #include "StdTypes.h"
 
 #include "MemMap.h"
+#include <avr/pgmspace.h>
+
+#include "Timer_Interface.h"
 
 #include "RGB_Interface.h"
 #include "RGB_Cfg.h"
 #include "RGB_Private.h"
-#define F_CPU  8000000
-#include <util/delay.h>
 
 
+/*fade engine state , the tick runs in the Timer0 overflow ISR so the main loop
+ *functions change it with the interrupts off*/
+static u8 RGB_Overflows=0;
+static u16 RGB_Position[RGB];
+static s16 RGB_Step[RGB];
+static u16 RGB_TicksLeft=0;
+static RGB_Value_type RGB_Target;
+static RGB_Step_type RGB_Current;
+static RGB_Step_type RGB_Queue[RGB_QUEUE_SIZE];
+static u8 RGB_QueueHead=0;
+static u8 RGB_QueueCount=0;
+static u8 RGB_Loop=0;
+
 void RGB_Runnable(void)
 {
 	u8 i;
-	for(i=0;i<14;i++)
+	RGB_Value_type color;
+	if(RGB_IsFading()==0)
 	{
-		OCR1A=RGB_RedColors[i][0];
-		OCR1B=RGB_RedColors[i][1];
-		OCR0=RGB_RedColors[i][2];
-		_delay_ms(1000);
+		/*the table holds every channel -1 (0 is 255)*/
+		for(i=0;i<14;i++)
+		{
+			color.Red=RGB_RedColors[i][0]+1;
+			color.Green=RGB_RedColors[i][1]+1;
+			color.Blue=RGB_RedColors[i][2]+1;
+			RGB_QueueFade(color,1000);
+		}
+		RGB_SetLoop(1);
 	}
 }
 
@@ -26,4 +46,179 @@ void RGB_SetColour(RGB_Color_type Color)
 	OCR1A=RGB_BasicsColors[Color][0];
 	OCR1B=RGB_BasicsColors[Color][1];
 	OCR0=RGB_BasicsColors[Color][2];
+}
+
+void RGB_FadeInit(void)
+{
+	u8 i;
+	for(i=0;i<RGB;i++)
+	{
+		RGB_Position[i]=0;
+		RGB_Step[i]=0;
+	}
+	RGB_TicksLeft=0;
+	RGB_QueueHead=0;
+	RGB_QueueCount=0;
+	RGB_Loop=0;
+	RGB_Overflows=0;
+	RGB_Output();
+	/*red and green : Timer1 fast PWM with ICR1 top , blue : Timer0 fast PWM*/
+	ICR1=RGB_PWM_TOP;
+	Timer1_Init(TIMER1_FASTPWM_ICR_TOP_MODE,RGB_PWM_SCALER1);
+	Timer1_OCRA1Mode(OCRA_NON_INVERTING);
+	Timer1_OCRB1Mode(OCRB_NON_INVERTING);
+	TIMER0_Init(TIMER0_FASTPWM_MODE,RGB_PWM_SCALER0);
+	TIMER0_OC0Mode(OC0_NON_INVERTING);
+	TIMER0_OV_SetCallBack(RGB_PwmOverflow);
+	TIMER0_OV_InterruptEnable();
+}
+
+void RGB_FadeTo(RGB_Value_type Color,u16 DurationMs)
+{
+	RGB_Step_type step;
+	u8 sreg;
+	step.Color=Color;
+	step.Ticks=RGB_TICKS(DurationMs);
+	sreg=SREG;
+	cli();
+	RGB_QueueCount=0;
+	RGB_StartStep(&step);
+	SREG=sreg;
+}
+
+Error_t RGB_QueueFade(RGB_Value_type Color,u16 DurationMs)
+{
+	Error_t status=OK;
+	RGB_Step_type step;
+	u8 sreg;
+	step.Color=Color;
+	step.Ticks=RGB_TICKS(DurationMs);
+	sreg=SREG;
+	cli();
+	if(RGB_TicksLeft==0)
+	{
+		/*nothing running , start now*/
+		RGB_StartStep(&step);
+	}
+	else if(RGB_QueueCount<RGB_QUEUE_SIZE)
+	{
+		RGB_Queue[(RGB_QueueHead+RGB_QueueCount)%RGB_QUEUE_SIZE]=step;
+		RGB_QueueCount++;
+	}
+	else
+	{
+		status=NOK;
+	}
+	SREG=sreg;
+	return status;
+}
+
+void RGB_SetLoop(u8 Loop)
+{
+	RGB_Loop=Loop;
+}
+
+u8 RGB_IsFading(void)
+{
+	u8 fading,sreg=SREG;
+	cli();
+	fading=(RGB_TicksLeft!=0)||(RGB_QueueCount!=0);
+	SREG=sreg;
+	return fading;
+}
+
+/*the only division of a fade : the step of every channel is computed once here*/
+static void RGB_StartStep(const RGB_Step_type*step)
+{
+	u8 i;
+	u8 target[RGB]={step->Color.Red,step->Color.Green,step->Color.Blue};
+	RGB_Current=*step;
+	RGB_Target=step->Color;
+	if(step->Ticks==0)
+	{
+		for(i=0;i<RGB;i++)
+		{
+			RGB_Position[i]=(u16)target[i]<<RGB_FRACTION_BITS;
+		}
+		/*one tick so the loop and the queue go on from the tick*/
+		RGB_TicksLeft=1;
+		RGB_Output();
+	}
+	else
+	{
+		for(i=0;i<RGB;i++)
+		{
+			RGB_Step[i]=(s16)((((s32)target[i]<<RGB_FRACTION_BITS)-(s32)RGB_Position[i])/(s32)step->Ticks);
+		}
+		RGB_TicksLeft=step->Ticks;
+	}
+}
+
+/*Timer0 overflow , one fade tick every RGB_TICK_OVERFLOWS PWM periods*/
+static void RGB_PwmOverflow(void)
+{
+	RGB_Overflows++;
+	if(RGB_Overflows>=RGB_TICK_OVERFLOWS)
+	{
+		RGB_Overflows=0;
+		RGB_FadeTick();
+	}
+}
+
+/*constant cost per tick : 3 additions and 3 table reads*/
+static void RGB_FadeTick(void)
+{
+	u8 i;
+	RGB_Step_type next;
+	if(RGB_TicksLeft==0)
+	{
+		return;
+	}
+	RGB_TicksLeft--;
+	if(RGB_TicksLeft==0)
+	{
+		/*end exactly on the target whatever the rounding of the step*/
+		RGB_Position[0]=(u16)RGB_Target.Red<<RGB_FRACTION_BITS;
+		RGB_Position[1]=(u16)RGB_Target.Green<<RGB_FRACTION_BITS;
+		RGB_Position[2]=(u16)RGB_Target.Blue<<RGB_FRACTION_BITS;
+		RGB_Output();
+		if(RGB_QueueCount)
+		{
+			next=RGB_Queue[RGB_QueueHead];
+			RGB_QueueHead=(RGB_QueueHead+1)%RGB_QUEUE_SIZE;
+			RGB_QueueCount--;
+			if(RGB_Loop)
+			{
+				/*the finished fade goes to the end , there is room since next was taken out*/
+				RGB_Queue[(RGB_QueueHead+RGB_QueueCount)%RGB_QUEUE_SIZE]=RGB_Current;
+				RGB_QueueCount++;
+			}
+			RGB_StartStep(&next);
+		}
+		else if(RGB_Loop)
+		{
+			RGB_StartStep(&RGB_Current);
+		}
+	}
+	else
+	{
+		for(i=0;i<RGB;i++)
+		{
+			RGB_Position[i]+=RGB_Step[i];
+		}
+		RGB_Output();
+	}
+}
+
+static void RGB_Output(void)
+{
+#if RGB_COMMON_ANODE
+	OCR1A=255-pgm_read_byte(&RGB_Gamma[RGB_Position[0]>>RGB_FRACTION_BITS]);
+	OCR1B=255-pgm_read_byte(&RGB_Gamma[RGB_Position[1]>>RGB_FRACTION_BITS]);
+	OCR0=255-pgm_read_byte(&RGB_Gamma[RGB_Position[2]>>RGB_FRACTION_BITS]);
+#else
+	OCR1A=pgm_read_byte(&RGB_Gamma[RGB_Position[0]>>RGB_FRACTION_BITS]);
+	OCR1B=pgm_read_byte(&RGB_Gamma[RGB_Position[1]>>RGB_FRACTION_BITS]);
+	OCR0=pgm_read_byte(&RGB_Gamma[RGB_Position[2]>>RGB_FRACTION_BITS]);
+#endif
 }
\ No newline at end of file
@@ -6,6 +6,17 @@
 #define NUM_OF_COLORS 16
 #define RGB  3
 
+/*8MHz/64/256 --> 488Hz PWM on Timer0 and Timer1 , one overflow every 2.048ms*/
+#define RGB_PWM_SCALER0    TIMER0_SCALER_64
+#define RGB_PWM_SCALER1    TIMER1_SCALER_64
+#define RGB_PWM_PRESCALER  64
+/*the fade engine updates the PWM every RGB_TICK_MS (rounded to whole Timer0 overflows)*/
+#define RGB_TICK_MS        10
+/*fades waiting after the current one*/
+#define RGB_QUEUE_SIZE     16
+/*1 : LED anode on VCC , the PWM output is inverted in software*/
+#define RGB_COMMON_ANODE   0
+
 
 
 #endif /* RGB_CFG_H_ */
\ No newline at end of file
@@ -23,9 +23,30 @@ typedef enum{
 }RGB_Color_type;
 
 
+typedef struct{
+	u8 Red;
+	u8 Green;
+	u8 Blue;
+	}RGB_Value_type;
+
+/*non blocking : starts the red shades sequence once , 1s fade to every shade in a loop*/
 void RGB_Runnable(void);
 void RGB_SetColour(RGB_Color_type Color);
 
+/*fade engine : brightness 0:255 per channel , gamma corrected to OC1A(red) OC1B(green) OC0(blue)
+ *it owns Timer0 and Timer1 : both run 8 bit fast PWM and the fade steps on the Timer0 overflow ,
+ *so it can't be used with SysTime , SoftTimer , Ultrasonic , 7-segment , Servo or a motor on OC0/OC1x
+ *GLOBAL_ENABLE();*/
+void RGB_FadeInit(void);
+/*drops the queue and fades from the current color to Color in DurationMs (0 : at once)*/
+void RGB_FadeTo(RGB_Value_type Color,u16 DurationMs);
+/*adds a fade after the last queued one , NOK if the queue is full*/
+Error_t RGB_QueueFade(RGB_Value_type Color,u16 DurationMs);
+/*1 : every finished fade goes back to the end of the queue (the sequence repeats)*/
+void RGB_SetLoop(u8 Loop);
+/*1 while a fade is running or queued*/
+u8 RGB_IsFading(void);
+
 
 
 #endif /* RGB_INTERFACE_H_ */
\ No newline at end of file
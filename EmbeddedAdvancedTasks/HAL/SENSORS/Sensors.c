@@ -5,25 +5,141 @@
 #include "Sensors_Private.h"
 #include "Sensors_Cfg.h"
 
+/*scan position of every sensor (ADC_SCAN_NOT_FOUND if its channel is not scanned)*/
+static u8 Sensors_ScanIndex[SENSORS_NUMBER];
+static s16 Sensors_Values[SENSORS_NUMBER];
+
+Error_t Sensors_Init(void)
+{
+	u8 Local_u8Sensor;
+	Error_t Local_Status=OK;
+	for(Local_u8Sensor=0;Local_u8Sensor<SENSORS_NUMBER;Local_u8Sensor++)
+	{
+		Sensors_ScanIndex[Local_u8Sensor]=ADC_ScanGetIndex(SensorsArray[Local_u8Sensor].Channel);
+		Sensors_Values[Local_u8Sensor]=0;
+		if(Sensors_ScanIndex[Local_u8Sensor]==ADC_SCAN_NOT_FOUND)
+		{
+			Local_Status=NOK;
+		}
+	}
+	return Local_Status;
+}
+
+Error_t Sensors_Update(void)
+{
+	u8 Local_u8Sensor;
+	Error_t Local_Status=OK;
+	for(Local_u8Sensor=0;Local_u8Sensor<SENSORS_NUMBER;Local_u8Sensor++)
+	{
+		if(Sensors_ScanIndex[Local_u8Sensor]!=ADC_SCAN_NOT_FOUND)
+		{
+			Sensors_Values[Local_u8Sensor]=Sensors_Convert(Local_u8Sensor,ADC_ScanGetReading(Sensors_ScanIndex[Local_u8Sensor]));
+		}
+		else
+		{
+			/*ADC_Read would change the MUX and wait on ADIF while the scan owns the ADC*/
+			Local_Status=NOK;
+		}
+	}
+	return Local_Status;
+}
+
+s16 Sensors_GetValue(Sensor_Id_type sensor)
+{
+	s16 Local_s16Value=0;
+	if(sensor<SENSORS_NUMBER)
+	{
+		Local_s16Value=Sensors_Values[sensor];
+	}
+	return Local_s16Value;
+}
+
+Sensor_Unit_type Sensors_GetUnit(Sensor_Id_type sensor)
+{
+	Sensor_Unit_type Local_Unit=UNIT_MILLIVOLT;
+	if(sensor<SENSORS_NUMBER)
+	{
+		Local_Unit=SensorsArray[sensor].Unit;
+	}
+	return Local_Unit;
+}
+
+s16 Sensors_Convert(Sensor_Id_type sensor,u16 raw)
+{
+	s16 Local_s16Value=0;
+	if(sensor<SENSORS_NUMBER)
+	{
+		if(SensorsArray[sensor].Calibration==SENSOR_PIECEWISE)
+		{
+			Local_s16Value=Sensors_Piecewise(&SensorsArray[sensor],raw);
+		}
+		else if(SensorsArray[sensor].Calibration==SENSOR_LINEAR_MILLIVOLT)
+		{
+			Local_s16Value=Sensors_Linear(&SensorsArray[sensor],ADC_ConvertToVolt(raw));
+		}
+		else
+		{
+			Local_s16Value=Sensors_Linear(&SensorsArray[sensor],raw);
+		}
+	}
+	return Local_s16Value;
+}
+
+static s16 Sensors_Linear(const Sensor_type*Copy_pSensor,u16 Copy_u16Raw)
+{
+	s32 Local_s32Value=((s32)Copy_u16Raw-Copy_pSensor->RawOffset)*Copy_pSensor->Gain;
+	/*round to nearest, shift the magnitude to not depend on the sign shift of the compiler*/
+	if(Local_s32Value<0)
+	{
+		Local_s32Value=-((-Local_s32Value+SENSORS_Q16_HALF)>>SENSORS_Q16_SHIFT);
+	}
+	else
+	{
+		Local_s32Value=(Local_s32Value+SENSORS_Q16_HALF)>>SENSORS_Q16_SHIFT;
+	}
+	return (s16)(Local_s32Value+Copy_pSensor->Offset);
+}
+
+static s16 Sensors_Piecewise(const Sensor_type*Copy_pSensor,u16 Copy_u16Raw)
+{
+	u8 Local_u8Point;
+	const Sensor_Point_type*Local_pPoints=Copy_pSensor->Points;
+	s16 Local_s16Value;
+	if(Copy_u16Raw<=Local_pPoints[0].Raw)
+	{
+		Local_s16Value=Local_pPoints[0].Value;
+	}
+	else
+	{
+		/*clamp to the last point if the reading is after the table*/
+		Local_s16Value=Local_pPoints[Copy_pSensor->PointsNumber-1].Value;
+		for(Local_u8Point=1;Local_u8Point<Copy_pSensor->PointsNumber;Local_u8Point++)
+		{
+			if(Copy_u16Raw<=Local_pPoints[Local_u8Point].Raw)
+			{
+				Local_s16Value=Local_pPoints[Local_u8Point-1].Value+
+				               (s16)(((s32)(Local_pPoints[Local_u8Point].Value-Local_pPoints[Local_u8Point-1].Value)*
+				                      (Copy_u16Raw-Local_pPoints[Local_u8Point-1].Raw))/
+				                     (s32)(Local_pPoints[Local_u8Point].Raw-Local_pPoints[Local_u8Point-1].Raw));
+				break;
+			}
+		}
+	}
+	return Local_s16Value;
+}
 
 /* return temperture*10 */
 u16 TEMP_Read(void)
 {
-	u16 volt,temp;
-	volt=ADC_VoltRead(LM35_CH);
 	/*equation of lm35 is volt=mv/10
-	*temp=volt (mv)/10;
+	*temp=volt (mv)/10; the millivolts use the reference selected in ADC_Init
 	*i will return the temperature but multiple in 10 to take the more accuracy  
 	*/
-	temp=volt;
-	return temp;
+	return (u16)Sensors_Convert(SENSOR_LM35,ADC_Read(LM35_CH));
 }
 
 /*return pressure measure by (mkpa) and return pressure *10  */
 u16 MPX_4115_()
 {
-	u16 ADC_Value,MPX_Pressure_Value;
-	ADC_Value=ADC_Read(MPX4115_CH);
-	MPX_Pressure_Value=(((u32)(ADC_Value-55)*1000)/921)+150;
-	return MPX_Pressure_Value;
+	return (u16)Sensors_Convert(SENSOR_MPX4115,ADC_Read(MPX4115_CH));
 }
\ No newline at end of file
@@ -1,11 +1,26 @@
 
-
 #ifndef SENSORS_CFG_H_
 #define SENSORS_CFG_H_
 
 #define LM35_CH   CH_7
 #define MPX4115_CH  CH_5
 
+/*Adding a sensor : add its name in Sensor_Id_type and its entry here (same order)
+ *the channel must be in ADC_SCAN_CHANNELS, Sensors_Update never reads the ADC itself
+ *
+ *LM35    : 10mv/C --> temp*10 = mv (millivolt calibration, any reference) --> Gain=1*65536=65536
+ *MPX4115 : kpa*10 = (Raw-55)*1000/921+150          --> Gain=1.0858*65536=71157
+ *
+ *piecewise example (thermistor table):
+ *const Sensor_Point_type NTC_Points[]={{100,1250},{300,700},{600,250},{900,-50}};
+ *{CH_0,SENSOR_PIECEWISE,0,0,0,NTC_Points,4,UNIT_CELSIUS_X10}
+ */
+const Sensor_type SensorsArray[SENSORS_NUMBER]={
+	/*channel     calibration     RawOffset Gain   Offset Points PointsNumber unit*/
+	{LM35_CH,    SENSOR_LINEAR_MILLIVOLT, 0,  65536,  0,    NULLPTR,  0,   UNIT_CELSIUS_X10},
+	{MPX4115_CH, SENSOR_LINEAR,           55, 71157,  150,  NULLPTR,  0,   UNIT_KPA_X10}
+};
+
 
 
 #endif /* SENSORS_CFG_H_ */
\ No newline at end of file
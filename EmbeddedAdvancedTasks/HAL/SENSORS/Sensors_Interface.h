@@ -1,8 +1,61 @@
 
-
 #ifndef SENSORS_INTERFACE_H_
 #define SENSORS_INTERFACE_H_
 
+/*one name for every entry of SensorsArray in Sensors_Cfg.h (same order)*/
+typedef enum{
+	SENSOR_LM35=0,
+	SENSOR_MPX4115,
+	SENSORS_NUMBER
+	}Sensor_Id_type;
+
+typedef enum{
+	SENSOR_LINEAR=0,
+	SENSOR_LINEAR_MILLIVOLT,
+	SENSOR_PIECEWISE
+	}Sensor_Calibration_type;
+
+typedef enum{
+	UNIT_CELSIUS_X10=0,
+	UNIT_KPA_X10,
+	UNIT_MILLIVOLT
+	}Sensor_Unit_type;
+
+/*one point of a piecewise calibration, the points are sorted by Raw*/
+typedef struct{
+	u16 Raw;
+	s16 Value;
+	}Sensor_Point_type;
+
+typedef struct{
+	ADC_Channel_type Channel;
+	Sensor_Calibration_type Calibration;
+	/*linear : Value=((Raw-RawOffset)*Gain)/65536+Offset  (Gain is Q16)
+	 *linear millivolt : the same with the millivolts of the reading (ADC_ConvertToVolt)
+	 *in place of Raw, so it follows the reference selected in ADC_Init*/
+	u16 RawOffset;
+	s32 Gain;
+	s16 Offset;
+	/*piecewise : interpolation between the table points*/
+	const Sensor_Point_type*Points;
+	u8 PointsNumber;
+	Sensor_Unit_type Unit;
+	}Sensor_type;
+
+/*finds the scan position of every sensor channel
+ *returns NOK if the channel of a sensor is not in ADC_SCAN_CHANNELS*/
+Error_t Sensors_Init(void);
+/*converts the latest ADC scan readings of all the sensors, call it after ADC_ScanIsNewData
+ *the scan owns the ADC so a sensor on a channel that is not scanned is never read,
+ *its value is not updated and NOK is returned*/
+Error_t Sensors_Update(void);
+/*last value computed by Sensors_Update in the sensor unit*/
+s16 Sensors_GetValue(Sensor_Id_type sensor);
+Sensor_Unit_type Sensors_GetUnit(Sensor_Id_type sensor);
+/*applies the calibration of a sensor on a raw reading*/
+s16 Sensors_Convert(Sensor_Id_type sensor,u16 raw);
+
+/*blocking reads with ADC_Read, only when the ADC scan is not running*/
 /*return temperture*10*/
 u16 TEMP_Read(void);
 /*return pressure *10*/
@@ -1,11 +1,13 @@
 
 
-
 #ifndef SENSORS_PRIVATE_H_
 #define SENSORS_PRIVATE_H_
 
+#define SENSORS_Q16_SHIFT   16
+#define SENSORS_Q16_HALF    0x8000L
 
-
+static s16 Sensors_Linear(const Sensor_type*Copy_pSensor,u16 Copy_u16Raw);
+static s16 Sensors_Piecewise(const Sensor_type*Copy_pSensor,u16 Copy_u16Raw);
 
 
 #endif /* SENSORS_PRIVATE_H_ */
\ No newline at end of file
@@ -1,11 +1,22 @@
 #include "StdTypes.h"
 #include "MemMap.h"
+#include <avr/pgmspace.h>
 
 #include "Timer_Interface.h"
 #include "Servo_Interface.h"
 #include "Servo_Cfg.h"
 #include "Servo_Private.h"
 
+/*angle --> OCR1B of every profile , computed at build time and kept in flash*/
+static const u16 SERVO_KitTable[SERVO_MAX_ANGLE+1] PROGMEM=SERVO_TABLE(SERVO_KIT_MIN_US,SERVO_KIT_MAX_US);
+static const u16 SERVO_ProteusTable[SERVO_MAX_ANGLE+1] PROGMEM=SERVO_TABLE(SERVO_PROTEUS_MIN_US,SERVO_PROTEUS_MAX_US);
+static const u16*const SERVO_Tables[SERVO_PROFILES_NUMBER]={SERVO_KitTable,SERVO_ProteusTable};
+
+/*same pointer type as the 16 bit registers in MemMap.h*/
+static volatile unsigned short*const SERVO_Registers[SERVO_NUMBER]=SERVO_REGISTERS;
+static const Servo_Profile_type SERVO_Profiles[SERVO_NUMBER]=SERVO_PROFILES;
+static volatile Servo_Motion_type SERVO_Motion[SERVO_NUMBER];
+
 void SERVO_Init(void)
 {
 	/*set the start value of SERVO_REGISTER*/
@@ -13,45 +24,169 @@ void SERVO_Init(void)
 	/*you can use timer1 but set mode fast mode OCR1A top or OCR1B top or ICU mode
 	 * to set frequency 20000 (from data sheet servo) but in register 19999
 	 *ex:
-	 *Timer1_Init(TIMER1_FASTPWM_OCRA_TOP_MODE,TIMER1_SCALER_8);     
+	 *Timer1_Init(TIMER1_FASTPWM_OCRA_TOP_MODE,TIMER1_PERIOD_SCALER(20000));   --> TIMER1_SCALER_8
 	 *Timer1_OCRB1Mode(OCRB_NON_INVERTING);  to change in duty cycle from real motor 500 to 2500 or proteus from 1000 to 2000
-	 *OCR1A=19999;    to set frequeny 50hz (T(total)=20000
+	 *OCR1A=TIMER1_PERIOD_TOP(20000);    to set frequeny 50hz (T(total)=20000us) --> 19999
 	 */
 }
 void SERVO_SetAngleInProteus(u8 Copy_u8Angle)
 {
-	/*  interpolation 
-	 *this servo start from 1000    2000
-	 *     angle start from  0       180
-	 *slope=(2000-1000)/(180-0)=1000/180
-	 *y-y1=slope(x-x1)  -->  OCR1B-OCR1B1=slope(angle-angle1)
-	 * OCR1B=(1000/180)(180-0)+999   --> OCR1B=(((u32)Copy_u8Angle*1000)/(u32)180)+999
-	 */
-	if(Copy_u8Angle>180)
+	/*the table holds OCR1B=(((u32)angle*1000+90)/180)+999 for every angle (the best method)*/
+	if(Copy_u8Angle>SERVO_MAX_ANGLE)
 	{
-		Copy_u8Angle=180;
+		Copy_u8Angle=SERVO_MAX_ANGLE;
 	}
-	SERVO_REGISTER=(((u32)Copy_u8Angle*1000)/(u32)180)+999;
-	/*to get more accuracy in angle you have to method
-	 * 1-->add 90 to equation OCR1B=(((u32)Copy_u8Angle*1000+90)/(32)180)+999;
-	 * 2-->do array and put the values of OCR1B  (the best method)
-	 */
+	SERVO_REGISTER=pgm_read_word(&SERVO_ProteusTable[Copy_u8Angle]);
 }
 void SERVO_SetAngle(u8 Copy_u8Angle)
 {
-	/*this servo start from 500     2500
-	 *     angle start from  0       180
-	 *slope=(2500-500)/(180-0)=2000/180
-	 *y-y1=slope(x-x1)  -->  OCR1B-OCR1B1=slope(angle-angle1)
-	 * OCR1B=(2000/180)(180-0)+499   --> OCR1B=(((u32)Copy_u8Angle*2000)/(u32)180)+499
-	 */
-	if(Copy_u8Angle>180)
+	/*the table holds OCR1B=(((u32)angle*2000+90)/180)+499 for every angle*/
+	if(Copy_u8Angle>SERVO_MAX_ANGLE)
 	{
-		Copy_u8Angle=180;
+		Copy_u8Angle=SERVO_MAX_ANGLE;
 	}
-	SERVO_REGISTER=(((u32)Copy_u8Angle*2000)/(u32)180)+499;
-	/*to get more accuracy in angle you have to method
-	 * 1-->add 90 to equation OCR1B=(((u32)Copy_u8Angle*1000+90)/(32)180)+999;
-	 * 2-->do array and put the values of OCR1B  (the best method)
-	 */
+	SERVO_REGISTER=pgm_read_word(&SERVO_KitTable[Copy_u8Angle]);
+}
+
+void SERVO_MotionInit(void)
+{
+	u8 Local_u8Servo;
+	for(Local_u8Servo=0;Local_u8Servo<SERVO_NUMBER;Local_u8Servo++)
+	{
+		SERVO_SetPosition(Local_u8Servo,SERVO_START_ANGLE);
+	}
+	/*the overflow comes once per PWM period , the new OCR is taken at the next TOP*/
+	Timer1_OVF_SetCallBack(SERVO_MotionTick);
+	Timer1_OVF_InterruptEnable();
 }
+
+void SERVO_MoveTo(u8 Copy_u8Servo,u8 Copy_u8Angle)
+{
+	u8 Local_u8Sreg;
+	if(Copy_u8Servo<SERVO_NUMBER)
+	{
+		if(Copy_u8Angle>SERVO_MAX_ANGLE)
+		{
+			Copy_u8Angle=SERVO_MAX_ANGLE;
+		}
+		Local_u8Sreg=SREG;
+		cli();
+		SERVO_Motion[Copy_u8Servo].Target=(u16)Copy_u8Angle<<SERVO_FRACTION_BITS;
+		SREG=Local_u8Sreg;
+	}
+}
+
+void SERVO_SetPosition(u8 Copy_u8Servo,u8 Copy_u8Angle)
+{
+	u8 Local_u8Sreg;
+	if(Copy_u8Servo<SERVO_NUMBER)
+	{
+		if(Copy_u8Angle>SERVO_MAX_ANGLE)
+		{
+			Copy_u8Angle=SERVO_MAX_ANGLE;
+		}
+		Local_u8Sreg=SREG;
+		cli();
+		SERVO_Motion[Copy_u8Servo].Position=(u16)Copy_u8Angle<<SERVO_FRACTION_BITS;
+		SERVO_Motion[Copy_u8Servo].Target=SERVO_Motion[Copy_u8Servo].Position;
+		SERVO_Motion[Copy_u8Servo].Speed=0;
+		SERVO_Motion[Copy_u8Servo].Direction=0;
+		*SERVO_Registers[Copy_u8Servo]=SERVO_AngleToOcr(SERVO_Profiles[Copy_u8Servo],SERVO_Motion[Copy_u8Servo].Position);
+		SREG=Local_u8Sreg;
+	}
+}
+
+u8 SERVO_IsMoving(u8 Copy_u8Servo)
+{
+	u8 Local_u8Moving=0;
+	u8 Local_u8Sreg;
+	if(Copy_u8Servo<SERVO_NUMBER)
+	{
+		Local_u8Sreg=SREG;
+		cli();
+		Local_u8Moving=(SERVO_Motion[Copy_u8Servo].Position!=SERVO_Motion[Copy_u8Servo].Target)||(SERVO_Motion[Copy_u8Servo].Speed!=0);
+		SREG=Local_u8Sreg;
+	}
+	return Local_u8Moving;
+}
+
+/*between two table entries the OCR is interpolated with the fraction of the degree*/
+static u16 SERVO_AngleToOcr(Servo_Profile_type Copy_Profile,u16 Copy_u16Position)
+{
+	const u16*Local_pu16Table=SERVO_Tables[Copy_Profile];
+	u8 Local_u8Angle=(u8)(Copy_u16Position>>SERVO_FRACTION_BITS);
+	u8 Local_u8Fraction=(u8)Copy_u16Position;
+	u16 Local_u16Ocr=pgm_read_word(&Local_pu16Table[Local_u8Angle]);
+	if((Local_u8Fraction!=0)&&(Local_u8Angle<SERVO_MAX_ANGLE))
+	{
+		Local_u16Ocr+=(u16)(((u16)(pgm_read_word(&Local_pu16Table[Local_u8Angle+1])-Local_u16Ocr)*Local_u8Fraction)>>SERVO_FRACTION_BITS);
+	}
+	return Local_u16Ocr;
+}
+
+/*Timer1 overflow , once per PWM period for all the servos*/
+static void SERVO_MotionTick(void)
+{
+	u8 Local_u8Servo;
+	u16 Local_u16Remaining,Local_u16Speed;
+	s8 Local_s8Direction;
+	for(Local_u8Servo=0;Local_u8Servo<SERVO_NUMBER;Local_u8Servo++)
+	{
+		volatile Servo_Motion_type*Local_pMotion=&SERVO_Motion[Local_u8Servo];
+		if((Local_pMotion->Position==Local_pMotion->Target)&&(Local_pMotion->Speed==0))
+		{
+			continue;
+		}
+		if(Local_pMotion->Target>Local_pMotion->Position)
+		{
+			Local_s8Direction=1;
+			Local_u16Remaining=Local_pMotion->Target-Local_pMotion->Position;
+		}
+		else
+		{
+			Local_s8Direction=-1;
+			Local_u16Remaining=Local_pMotion->Position-Local_pMotion->Target;
+		}
+		Local_u16Speed=Local_pMotion->Speed;
+		if((Local_pMotion->Direction!=Local_s8Direction)&&(Local_u16Speed!=0))
+		{
+			/*the target is behind : slow down in the old direction first*/
+			Local_u16Speed=(Local_u16Speed>SERVO_ACCELERATION)?(Local_u16Speed-SERVO_ACCELERATION):0;
+			Local_s8Direction=Local_pMotion->Direction;
+			Local_u16Remaining=(Local_s8Direction>0)?(((u16)SERVO_MAX_ANGLE<<SERVO_FRACTION_BITS)-Local_pMotion->Position):Local_pMotion->Position;
+		}
+		else if(((u32)Local_u16Speed*Local_u16Speed)>=((u32)2*SERVO_ACCELERATION*Local_u16Remaining))
+		{
+			/*braking distance v^2/2a reached*/
+			Local_u16Speed=(Local_u16Speed>SERVO_ACCELERATION)?(Local_u16Speed-SERVO_ACCELERATION):SERVO_ACCELERATION;
+		}
+		else if(Local_u16Speed<SERVO_MAX_SPEED)
+		{
+			Local_u16Speed+=SERVO_ACCELERATION;
+			if(Local_u16Speed>SERVO_MAX_SPEED)
+			{
+				Local_u16Speed=SERVO_MAX_SPEED;
+			}
+		}
+		if(Local_u16Speed>=Local_u16Remaining)
+		{
+			/*arrived (or at the end of the range while reversing)*/
+			Local_u16Speed=Local_u16Remaining;
+		}
+		if(Local_s8Direction>0)
+		{
+			Local_pMotion->Position+=Local_u16Speed;
+		}
+		else
+		{
+			Local_pMotion->Position-=Local_u16Speed;
+		}
+		if(Local_pMotion->Position==Local_pMotion->Target)
+		{
+			Local_u16Speed=0;
+		}
+		Local_pMotion->Speed=Local_u16Speed;
+		Local_pMotion->Direction=Local_s8Direction;
+		*SERVO_Registers[Local_u8Servo]=SERVO_AngleToOcr(SERVO_Profiles[Local_u8Servo],Local_pMotion->Position);
+	}
+}
\ No newline at end of file
@@ -5,5 +5,23 @@
 
 #define SERVO_REGISTER  OCR1B
 
+/*pulse range of every profile in us (1 count = 1us with TIMER1_SCALER_8 at 8MHz)*/
+#define SERVO_KIT_MIN_US        500
+#define SERVO_KIT_MAX_US        2500
+#define SERVO_PROTEUS_MIN_US    1000
+#define SERVO_PROTEUS_MAX_US    2000
+
+/*servos moved by SERVO_MoveTo , one compare register each
+ *(OCR1A is free for a second servo with TIMER1_FASTPWM_ICR_TOP_MODE and ICR1=19999)*/
+#define SERVO_NUMBER            1
+#define SERVO_REGISTERS         {&OCR1B}
+#define SERVO_PROFILES          {SERVO_PROFILE_KIT}
+#define SERVO_START_ANGLE       90
+
+/*motion profile , the same for all the servos*/
+#define SERVO_PERIOD_US         20000
+#define SERVO_MAX_SPEED_DPS     180     /*degree per second*/
+#define SERVO_ACCELERATION_DPS2 360     /*degree per second^2*/
+
 
 #endif /* SERVO_CFG_H_ */
\ No newline at end of file
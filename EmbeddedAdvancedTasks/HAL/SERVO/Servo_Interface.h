@@ -3,9 +3,25 @@
 #ifndef SERVO_INTERFACE_H_
 #define SERVO_INTERFACE_H_
 
+typedef enum{
+	SERVO_PROFILE_KIT=0,      /*500us:2500us*/
+	SERVO_PROFILE_PROTEUS,    /*1000us:2000us*/
+	SERVO_PROFILES_NUMBER
+	}Servo_Profile_type;
+
 void SERVO_Init(void);
 void SERVO_SetAngleInProteus(u8 Copy_u8Angle);
 void SERVO_SetAngle(u8 Copy_u8Angle);
 
+/*smooth motion of the servos in Servo_Cfg.h , takes the Timer1 overflow call back
+ *Timer1 must run the 20ms PWM (see SERVO_Init) , so it can't be used with SysTime
+ *GLOBAL_ENABLE();*/
+void SERVO_MotionInit(void);
+/*moves to the angle with a trapezoidal speed profile (accelerate , cruise , decelerate)*/
+void SERVO_MoveTo(u8 Copy_u8Servo,u8 Copy_u8Angle);
+/*jumps to the angle at once and stops any motion*/
+void SERVO_SetPosition(u8 Copy_u8Servo,u8 Copy_u8Angle);
+u8 SERVO_IsMoving(u8 Copy_u8Servo);
+
 
 #endif /* SERVO_INTERFACE_H_ */
\ No newline at end of file
@@ -6,7 +6,41 @@
 #define START_VALUE_IN_PROTEUS   999
 #define START_VALUE_IN_KIT       499
 
+#define SERVO_MAX_ANGLE          180
 
+/*angle --> OCR1B rounded to the nearest count , evaluated by the compiler*/
+#define SERVO_OCR(angle,min,max)   ((u16)(((((u32)(angle))*((max)-(min))+(SERVO_MAX_ANGLE/2))/SERVO_MAX_ANGLE)+(min)-1))
+#define SERVO_ROW(a,min,max)       SERVO_OCR((a)+0,min,max),SERVO_OCR((a)+1,min,max),SERVO_OCR((a)+2,min,max),\
+                                   SERVO_OCR((a)+3,min,max),SERVO_OCR((a)+4,min,max),SERVO_OCR((a)+5,min,max),\
+                                   SERVO_OCR((a)+6,min,max),SERVO_OCR((a)+7,min,max),SERVO_OCR((a)+8,min,max),\
+                                   SERVO_OCR((a)+9,min,max)
+/*181 values : 0:180 degree*/
+#define SERVO_TABLE(min,max)       {SERVO_ROW(0,min,max),SERVO_ROW(10,min,max),SERVO_ROW(20,min,max),\
+                                    SERVO_ROW(30,min,max),SERVO_ROW(40,min,max),SERVO_ROW(50,min,max),\
+                                    SERVO_ROW(60,min,max),SERVO_ROW(70,min,max),SERVO_ROW(80,min,max),\
+                                    SERVO_ROW(90,min,max),SERVO_ROW(100,min,max),SERVO_ROW(110,min,max),\
+                                    SERVO_ROW(120,min,max),SERVO_ROW(130,min,max),SERVO_ROW(140,min,max),\
+                                    SERVO_ROW(150,min,max),SERVO_ROW(160,min,max),SERVO_ROW(170,min,max),\
+                                    SERVO_OCR(180,min,max)}
+
+/*positions and speeds in 1/256 degree , per PWM period*/
+#define SERVO_FRACTION_BITS      8
+#define SERVO_MAX_SPEED          ((SERVO_MAX_SPEED_DPS*256UL*SERVO_PERIOD_US)/1000000UL)
+#define SERVO_ACCELERATION       ((SERVO_ACCELERATION_DPS2*256UL*(SERVO_PERIOD_US/1000)*(SERVO_PERIOD_US/1000))/1000000UL)
+
+#if (SERVO_MAX_SPEED==0)||(SERVO_ACCELERATION==0)
+#error "SERVO : speed or acceleration too small for the PWM period"
+#endif
+
+typedef struct{
+	u16 Position;     /*1/256 degree*/
+	u16 Target;
+	u16 Speed;        /*1/256 degree per period*/
+	s8  Direction;
+	}Servo_Motion_type;
+
+static u16 SERVO_AngleToOcr(Servo_Profile_type Copy_Profile,u16 Copy_u16Position);
+static void SERVO_MotionTick(void);
 
 
 #endif /* SERVO_PRIVATE_H_ */
\ No newline at end of file
@@ -1,103 +1,146 @@
 #include "StdTypes.h"
+#include "Utils.h"
 #include "MemMap.h"
 
 #include "Timer_Interface.h"
 #include "DIO_Interface.h"
+#include "SysTime_Interface.h"
 #include "Ultrasonic_Interface.h"
-#include "Ultrasonic_Private.h"
 #include "Ultrasonic_Cfg.h"
+#include "Ultrasonic_Private.h"
 
-#define F_CPU  8000000
-#include <util/delay.h>
-
-static volatile u8 flag;
-static volatile u16 t1,t2;
-static volatile u8 c=0;
+static const DIO_Pin_type Ultrasonic_TriggerPins[ULTRASONIC_NUMBER]=ULTRASONIC_TRIGGER_PINS;
+static volatile u16 Ultrasonic_Distances[ULTRASONIC_NUMBER];
+static volatile u8 Ultrasonic_NewDistance[ULTRASONIC_NUMBER];
 
-/*for 4 ultrasonic*/
-//volatile DIO_Pin_type TRIG_PIN ;
+static volatile u8 Ultrasonic_State=ULTRASONIC_IDLE;
+static volatile u8 Ultrasonic_Current=0;
+static u16 Ultrasonic_TriggerTime;
+static u32 Ultrasonic_RiseTime;
 
 void ULTRASONIC_Init(void)
 {
-	/*you need to init timer1 in normal mode
-	 *open global interrupt
-	 *Timer1_Init(TIMER1_NORMAL_MODE,TIMER1_SCALER_8);
-	 GLOBAL_ENABLE();
-	 */
-	Timer1_ICU_SetCallBack(ULTRASONIC_FUNC);
+	u8 i;
+	for(i=0;i<ULTRASONIC_NUMBER;i++)
+	{
+		Ultrasonic_Distances[i]=ULTRASONIC_NO_ECHO;
+		Ultrasonic_NewDistance[i]=0;
+	}
+	Timer1_ICU_SetCallBack(ULTRASONIC_ICU);
+	Timer1_OCB_SetCallBack(ULTRASONIC_OCB);
 }
-static void ULTRASONIC_Trigger(void)
+
+void ULTRASONIC_Start(void)
 {
-	/*for 4 ultrasonic*/
-// 	DIO_WritePin(TRIG_PIN,HIGH);
-// 	_delay_us(10);
-// 	DIO_WritePin(TRIG_PIN,LOW);
-	DIO_WritePin(TRIGGER_PIN,HIGH);
-	_delay_us(10);
-	DIO_WritePin(TRIGGER_PIN,LOW);
+	u8 sreg;
+	if(Ultrasonic_State==ULTRASONIC_IDLE)
+	{
+		Ultrasonic_Current=0;
+		sreg=SREG;
+		cli();
+		ULTRASONIC_Trigger();
+		SREG=sreg;
+		Timer1_OCB_InterruptEnable();
+	}
 }
-u8 ULTRASONIC_Distance_BusyWait(void)
+
+void ULTRASONIC_Stop(void)
 {
-	u16 time,distance;
-	flag=0;
-	TCNT1=0;
-	ULTRASONIC_Trigger();
-	Timer1_ICU_InterruptEnable();
-	Timer1_InputCaptureEdge(RISING);
-	while(flag<2);
-	time=t2-t1;
-	/*distance by cm  distance=(340(m\s)*((time(us)/1000000)(s))*100) (cm)
-	*340 is velocity of sound  */
-	distance=time/58; 
-	_delay_ms(60);
-	return distance;
+	Timer1_OCB_InterruptDisable();
+	Timer1_ICU_InterruptDisable();
+	DIO_WritePin(Ultrasonic_TriggerPins[Ultrasonic_Current],LOW);
+	Ultrasonic_State=ULTRASONIC_IDLE;
 }
 
-ultrasonic_type ULTRASONIC_Distance_PeriodicCheck(u8*pdistance)
+ultrasonic_type ULTRASONIC_GetDistance(u8 sensor,u16*pdistance)
 {
-	u16 time;
-	static u8 FlagStart=0;
-	ultrasonic_type UltrasonicCheck=ULTRASONIC_NOK;
-	if(FlagStart==0)
+	ultrasonic_type UltrasonicCheck=ULTRASONIC_NOK;
+	u16 distance;
+	u8 sreg;
+	if(sensor<ULTRASONIC_NUMBER)
 	{
-		FlagStart=1;
-		flag=0;
-		/*first method do TCNT1=0 
-		 --> TCNT1=0;
-		 *second method do global variable in ISR function increment 
-		 then multiple counter in register but remember that register in timer1 is 16 bit= 65536
-		 to protected from overflow flag
-		 --> time=t2-t1+((u32)c*65536)
-		 */
-		ULTRASONIC_Trigger();
-		Timer1_ICU_InterruptEnable();
-		Timer1_InputCaptureEdge(RISING);
-	}
-	if(flag==2)
-	{
-		time=t2-t1+((u32)c*65536);
-		*pdistance=time/58; //distance by cm
-		_delay_ms(60);
-		FlagStart=0;
-		c=0;
-		UltrasonicCheck=ULTRASONIC_OK;
+		sreg=SREG;
+		cli();
+		distance=Ultrasonic_Distances[sensor];
+		SREG=sreg;
+		if(distance!=ULTRASONIC_NO_ECHO)
+		{
+			*pdistance=distance;
+			UltrasonicCheck=ULTRASONIC_OK;
+		}
 	}
 	return UltrasonicCheck;
 }
 
-static void ULTRASONIC_FUNC(void)
+u8 ULTRASONIC_IsNewDistance(u8 sensor)
 {
-	c++;
-	if(flag==0)
-	{
-		t1=ICR1;
-		Timer1_InputCaptureEdge(FALLING);
-		flag=1;
-	}
-	else if(flag==1)
-	{
-		t2=ICR1;
-		Timer1_ICU_InterruptDisable();
-		flag=2;
+	u8 NewDistance=0;
+	if(sensor<ULTRASONIC_NUMBER)
+	{
+		NewDistance=Ultrasonic_NewDistance[sensor];
+		Ultrasonic_NewDistance[sensor]=0;
+	}
+	return NewDistance;
+}
+
+/*starts the 10us pulse of the current sensor, OCB ends it (interrupts must be off)*/
+static void ULTRASONIC_Trigger(void)
+{
+	DIO_WritePin(Ultrasonic_TriggerPins[Ultrasonic_Current],HIGH);
+	Ultrasonic_TriggerTime=TCNT1;
+	OCR1B=Ultrasonic_TriggerTime+ULTRASONIC_TRIGGER_TICKS;
+	/*writing 1 clears a flag, a read-modify-write would also clear TOV1 that SysTime needs*/
+	TIFR=(1<<OCF1B);
+	Ultrasonic_State=ULTRASONIC_PULSE;
+}
+
+static void ULTRASONIC_OCB(void)
+{
+	if(Ultrasonic_State==ULTRASONIC_PULSE)
+	{
+		/*end of the pulse, wait the echo and come back at the end of the gap*/
+		DIO_WritePin(Ultrasonic_TriggerPins[Ultrasonic_Current],LOW);
+		Timer1_InputCaptureEdge(RISING);
+		TIFR=(1<<ICF1);
+		Timer1_ICU_InterruptEnable();
+		OCR1B=Ultrasonic_TriggerTime+ULTRASONIC_GAP_TICKS;
+		Ultrasonic_State=ULTRASONIC_WAIT_RISING;
+	}
+	else
+	{
+		/*gap is over, no complete echo means nothing in range*/
+		if(Ultrasonic_State!=ULTRASONIC_DONE)
+		{
+			Timer1_ICU_InterruptDisable();
+			Ultrasonic_Distances[Ultrasonic_Current]=ULTRASONIC_NO_ECHO;
+			Ultrasonic_NewDistance[Ultrasonic_Current]=1;
+		}
+		Ultrasonic_Current++;
+		if(Ultrasonic_Current==ULTRASONIC_NUMBER)
+		{
+			Ultrasonic_Current=0;
+		}
+		ULTRASONIC_Trigger();
+	}
+}
+
+static void ULTRASONIC_ICU(void)
+{
+	u32 time;
+	if(Ultrasonic_State==ULTRASONIC_WAIT_RISING)
+	{
+		Ultrasonic_RiseTime=SysTime_CaptureTicks();
+		Timer1_InputCaptureEdge(FALLING);
+		Ultrasonic_State=ULTRASONIC_WAIT_FALLING;
+	}
+	else if(Ultrasonic_State==ULTRASONIC_WAIT_FALLING)
+	{
+		time=(SysTime_CaptureTicks()-Ultrasonic_RiseTime)/ULTRASONIC_TICKS_PER_US;
+		Timer1_ICU_InterruptDisable();
+		/*distance by cm  distance=(340(m\s)*((time(us)/1000000)(s))*100) (cm)
+		*340 is velocity of sound  */
+		Ultrasonic_Distances[Ultrasonic_Current]=(u16)(time/ULTRASONIC_US_PER_CM);
+		Ultrasonic_NewDistance[Ultrasonic_Current]=1;
+		Ultrasonic_State=ULTRASONIC_DONE;
 	}
 }
\ No newline at end of file
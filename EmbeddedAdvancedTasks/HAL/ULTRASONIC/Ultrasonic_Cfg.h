@@ -1,11 +1,19 @@
 
-
-
 #ifndef ULTRASONIC_CFG_H_
 #define ULTRASONIC_CFG_H_
 
 #define TRIGGER_PIN   PINC2
 
+/*sensors fired one after the other, the echo pins are ORed (diodes or gate) to ICP1 (PIND6)*/
+#define ULTRASONIC_NUMBER         2
+#define ULTRASONIC_TRIGGER_PINS   {TRIGGER_PIN,PINC3}
+
+/*same as SYSTIME_TICKS_PER_US (Timer1 normal mode, TIMER1_SCALER_8 at 8MHz --> 1 tick = 1us)*/
+#define ULTRASONIC_TICKS_PER_US   1
+
+/*time between 2 triggers (echo timeout included), sensor datasheet asks for 60ms*/
+#define ULTRASONIC_GAP_US         60000
+
 
 
 #endif /* ULTRASONIC_CFG_H_ */
\ No newline at end of file
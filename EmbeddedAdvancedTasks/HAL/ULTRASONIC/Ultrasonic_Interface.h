@@ -7,9 +7,19 @@ typedef enum{
 	ULTRASONIC_NOK
 	}ultrasonic_type;
 
+/*takes the Timer1 ICU and OCB call backs
+ *you need to init the system time (Timer1 normal mode) and open global interrupt
+ *SysTime_Init();
+ *GLOBAL_ENABLE();
+ */
 void ULTRASONIC_Init(void);
-u8 ULTRASONIC_Distance_BusyWait(void);
-ultrasonic_type ULTRASONIC_Distance_PeriodicCheck(u8*pdistance);
+/*starts the round robin ranging of all the sensors, nothing blocks*/
+void ULTRASONIC_Start(void);
+void ULTRASONIC_Stop(void);
+/*last distance in cm of a sensor, ULTRASONIC_NOK if it has no echo yet (or out of range)*/
+ultrasonic_type ULTRASONIC_GetDistance(u8 sensor,u16*pdistance);
+/*1 once after every new measure of the sensor*/
+u8 ULTRASONIC_IsNewDistance(u8 sensor);
 
 
 
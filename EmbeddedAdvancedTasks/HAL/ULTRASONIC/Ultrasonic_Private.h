@@ -1,10 +1,28 @@
 
 
-
 #ifndef ULTRASONIC_PRIVATE_H_
 #define ULTRASONIC_PRIVATE_H_
 
-static void ULTRASONIC_FUNC(void);
+/*trigger pulse 10us*/
+#define ULTRASONIC_TRIGGER_TICKS  (10*ULTRASONIC_TICKS_PER_US)
+#define ULTRASONIC_GAP_TICKS      ((u16)((u32)ULTRASONIC_GAP_US*ULTRASONIC_TICKS_PER_US))
+/*distance(cm)=time(us)/58*/
+#define ULTRASONIC_US_PER_CM      58
+#define ULTRASONIC_NO_ECHO        0xFFFF
+
+/*ranging states*/
+#define ULTRASONIC_IDLE           0
+#define ULTRASONIC_PULSE          1
+#define ULTRASONIC_WAIT_RISING    2
+#define ULTRASONIC_WAIT_FALLING   3
+#define ULTRASONIC_DONE           4
+
+#if (ULTRASONIC_GAP_US*ULTRASONIC_TICKS_PER_US)>65535L
+#error "ULTRASONIC_GAP_US must fit one Timer1 period"
+#endif
+
+static void ULTRASONIC_ICU(void);
+static void ULTRASONIC_OCB(void);
 static void ULTRASONIC_Trigger(void);
 
 
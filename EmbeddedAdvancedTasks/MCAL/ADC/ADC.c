@@ -8,8 +8,30 @@
 #include "ADC_Cfg.h"
 
 u16 volt_ref;
+/*millivolt per ADC step in Q16, set with the reference in ADC_Init*/
+static u32 ADC_VoltMultiplier=ADC_VOLT_Q16(5000);
 static u8 ADC_ReadFlag=0;
 
+/*Scan engine : ADC_vect converts the channels one after the other into a double buffer*/
+static const ADC_Channel_type ADC_ScanChannels[ADC_SCAN_CHANNELS_NUMBER]=ADC_SCAN_CHANNELS;
+static u16 ADC_ScanBuffers[ADC_SCAN_BUFFERS][ADC_SCAN_CHANNELS_NUMBER];
+static volatile u8 ADC_ScanIndex=0;
+static volatile u8 ADC_ScanWriteBuffer=0;
+static volatile u8 ADC_ScanReadyBuffer=1;
+static volatile u8 ADC_ScanNewData=0;
+static volatile u8 ADC_ScanRunning=0;
+static void (*ADC_Scan_Fptr) (void)=NULLPTR;
+
+/*Auto trigger : one channel converted on every trigger event into a ring buffer*/
+static u16 ADC_Ring[ADC_RING_SIZE];
+static volatile u8 ADC_RingHead=0;
+static volatile u8 ADC_RingTail=0;
+static volatile u16 ADC_RingOverruns=0;
+static ADC_Trigger_type ADC_TriggerSource=ADC_TRIGGER_FREE_RUNNING;
+
+/*which engine owns ADC_vect*/
+static volatile u8 ADC_IsrMode=ADC_ISR_SCAN;
+
 void ADC_Init(ADC_VoltRef_type vref,ADC_Prescaler_type scaler)
 {
 	/*Vref*/
@@ -19,16 +41,19 @@ void ADC_Init(ADC_VoltRef_type vref,ADC_Prescaler_type scaler)
 		CLR_BIT(ADMUX,REFS1);
 		CLR_BIT(ADMUX,REFS0);
 		volt_ref=AREE;
+		ADC_VoltMultiplier=ADC_VOLT_Q16(AREE);
 		break;
 		case VREF_AVCC:
 		CLR_BIT(ADMUX,REFS1);
 		SET_BIT(ADMUX,REFS0);
 		volt_ref=5000;
+		ADC_VoltMultiplier=ADC_VOLT_Q16(5000);
 		break;
 		case VREF_256V:
 		SET_BIT(ADMUX,REFS1);
 		SET_BIT(ADMUX,REFS0);
 		volt_ref=2560;
+		ADC_VoltMultiplier=ADC_VOLT_Q16(2560);
 		break;
 	}
 	/*Clock*/
@@ -46,7 +71,7 @@ void ADC_Init(ADC_VoltRef_type vref,ADC_Prescaler_type scaler)
 }
 void ADC_StartConversion(ADC_Channel_type channel)
 {
-	if(ADC_ReadFlag=0)
+	if(ADC_ReadFlag==0)
 	{
 		/* select ch using mux*/
 		ADMUX=ADMUX&0xE0;
@@ -103,7 +128,9 @@ u16 ADC_Read(ADC_Channel_type channel)
 u8 ADC_Scale(u16 ADC_Value)
 {
 	u8 scale;
-	scale=(ADC_Value/1023.0)*100;
+	/*scale=(ADC_Value/1023.0)*100 without float :
+	 *100/1023 is precomputed in Q16 so it is one multiply, one add and taking the high 16 bits*/
+	scale=(((u32)ADC_Value*ADC_SCALE_Q16)+ADC_SCALE_BIAS)>>ADC_Q16_SHIFT;
 	return scale;
 }
 
@@ -116,6 +143,13 @@ u8 ADC_Scale(u16 ADC_Value)
 
 
 
+u16 ADC_ConvertToVolt(u16 value)
+{
+	/*volt(mv)=value*volt_ref/1024, volt_ref/1024 is precomputed in Q16 for the selected reference
+	*so no float and no division, the product needs u32 (1023*320000 for AVCC)*/
+	return (u16)(((u32)value*ADC_VoltMultiplier)>>ADC_Q16_SHIFT);
+}
+
 u16 ADC_ReadVolt(ADC_Channel_type channel)
 {
 	u16 volt,value;
@@ -124,6 +158,250 @@ u16 ADC_ReadVolt(ADC_Channel_type channel)
 	*and the maximum value of u16 is 65536 truncation will happen in this equation 
 	*you can solve this problem by casting 5000 to u32 (4 bytes)
 	*we multiple in 5000 to calculate the result by (mv)*/
-	volt=((value*(u32)volt_ref)/1024.0);
+	volt=ADC_ConvertToVolt(value);
 	return volt;
-}
\ No newline at end of file
+}
+
+/*********************************Scan engine*********************************************/
+/*while the scan is running don't use ADC_Read or ADC_StartConversion, the scan owns the MUX*/
+void ADC_ScanStart(void)
+{
+	/*the scan starts every conversion by itself, ADATE may be left on by ADC_AutoTriggerStart*/
+	CLR_BIT(ADCSRA,ADATE);
+	ADC_IsrMode=ADC_ISR_SCAN;
+	ADC_ScanIndex=0;
+	ADC_ScanRunning=1;
+	ADMUX=ADMUX&0xE0;
+	ADMUX=ADMUX|ADC_ScanChannels[0];
+	SET_BIT(ADCSRA,ADIE);
+	SET_BIT(ADCSRA,ADSC);
+}
+
+void ADC_ScanStop(void)
+{
+	ADC_ScanRunning=0;
+	CLR_BIT(ADCSRA,ADIE);
+}
+
+void ADC_ScanSetCallBack(void(*LocalFptr)(void))
+{
+	ADC_Scan_Fptr=LocalFptr;
+}
+
+const u16* ADC_ScanGetBuffer(void)
+{
+	/*valid until the next scan completes (read it in the call back or right after ADC_ScanIsNewData)*/
+	return ADC_ScanBuffers[ADC_ScanReadyBuffer];
+}
+
+u16 ADC_ScanGetReading(u8 Copy_u8Index)
+{
+	u16 Local_u16Reading=0;
+	u8 Local_u8Sreg;
+	if(Copy_u8Index<ADC_SCAN_CHANNELS_NUMBER)
+	{
+		/*the ISR can swap the buffers between the 2 bytes of the read,
+		 *SREG is restored so it also works from the scan call back*/
+		Local_u8Sreg=SREG;
+		cli();
+		Local_u16Reading=ADC_ScanBuffers[ADC_ScanReadyBuffer][Copy_u8Index];
+		SREG=Local_u8Sreg;
+	}
+	return Local_u16Reading;
+}
+
+/*position of a channel in the scan buffer, ADC_SCAN_NOT_FOUND if it is not scanned*/
+u8 ADC_ScanGetIndex(ADC_Channel_type channel)
+{
+	u8 Local_u8Index;
+	for(Local_u8Index=0;Local_u8Index<ADC_SCAN_CHANNELS_NUMBER;Local_u8Index++)
+	{
+		if(ADC_ScanChannels[Local_u8Index]==channel)
+		{
+			return Local_u8Index;
+		}
+	}
+	return ADC_SCAN_NOT_FOUND;
+}
+
+u8 ADC_ScanIsNewData(void)
+{
+	u8 Local_u8NewData=ADC_ScanNewData;
+	ADC_ScanNewData=0;
+	return Local_u8NewData;
+}
+
+static void ADC_ScanHandler(void)
+{
+	ADC_ScanBuffers[ADC_ScanWriteBuffer][ADC_ScanIndex]=ADC;
+	ADC_ScanIndex++;
+	if(ADC_ScanIndex==ADC_SCAN_CHANNELS_NUMBER)
+	{
+		/*full scan done : publish it and fill the other buffer next*/
+		ADC_ScanIndex=0;
+		ADC_ScanReadyBuffer=ADC_ScanWriteBuffer;
+		ADC_ScanWriteBuffer^=1;
+		ADC_ScanNewData=1;
+		if(ADC_Scan_Fptr!=NULLPTR)
+		{
+			ADC_Scan_Fptr();
+		}
+#if ADC_SCAN_MODE==ADC_SCAN_SINGLE
+		ADC_ScanStop();
+#endif
+	}
+	if(ADC_ScanRunning)
+	{
+		ADMUX=ADMUX&0xE0;
+		ADMUX=ADMUX|ADC_ScanChannels[ADC_ScanIndex];
+		SET_BIT(ADCSRA,ADSC);
+	}
+}
+
+/*********************************Auto trigger*********************************************/
+/*the sample rate is the rate of the trigger source, ex: Timer0 CTC with OCR0
+ *the source doesn't need its interrupt to be enabled, the ADC ISR clears its flag*/
+void ADC_AutoTriggerStart(ADC_Channel_type channel,ADC_Trigger_type trigger)
+{
+	CLR_BIT(ADCSRA,ADATE);
+	ADC_IsrMode=ADC_ISR_AUTO_TRIGGER;
+	ADC_TriggerSource=trigger;
+	ADC_RingHead=0;
+	ADC_RingTail=0;
+	ADC_RingOverruns=0;
+	/* select ch using mux*/
+	ADMUX=ADMUX&0xE0;
+	ADMUX=ADMUX|channel;
+	/*trigger source in ADTS2:0*/
+	SFIOR=(SFIOR&0x1F)|(trigger<<ADTS0);
+	SET_BIT(ADCSRA,ADIE);
+	SET_BIT(ADCSRA,ADATE);
+	if(trigger==ADC_TRIGGER_FREE_RUNNING)
+	{
+		/*free running needs the first conversion to be started*/
+		SET_BIT(ADCSRA,ADSC);
+	}
+}
+
+void ADC_AutoTriggerStop(void)
+{
+	CLR_BIT(ADCSRA,ADATE);
+	CLR_BIT(ADCSRA,ADIE);
+}
+
+u8 ADC_AutoTriggerAvailable(void)
+{
+	return (u8)(ADC_RingHead-ADC_RingTail)&(ADC_RING_SIZE-1);
+}
+
+Error_t ADC_AutoTriggerReadBlock(u16*Copy_pu16Block,u8 Copy_u8Size)
+{
+	u8 Local_u8Iterator,Local_u8Tail;
+	Error_t Local_Status=OUTOFRANGE;
+	if((Copy_u8Size==0)||(Copy_u8Size>(ADC_RING_SIZE-1)))
+	{
+		Local_Status=NOK;
+	}
+	else if(ADC_AutoTriggerAvailable()>=Copy_u8Size)
+	{
+		/*only the ISR moves the head and only this function moves the tail*/
+		Local_u8Tail=ADC_RingTail;
+		for(Local_u8Iterator=0;Local_u8Iterator<Copy_u8Size;Local_u8Iterator++)
+		{
+			Copy_pu16Block[Local_u8Iterator]=ADC_Ring[Local_u8Tail];
+			Local_u8Tail=(Local_u8Tail+1)&(ADC_RING_SIZE-1);
+		}
+		ADC_RingTail=Local_u8Tail;
+		Local_Status=OK;
+	}
+	return Local_Status;
+}
+
+u16 ADC_AutoTriggerGetOverruns(void)
+{
+	u16 Local_u16Overruns;
+	u8 Local_u8Sreg=SREG;
+	cli();
+	Local_u16Overruns=ADC_RingOverruns;
+	SREG=Local_u8Sreg;
+	return Local_u16Overruns;
+}
+
+static void ADC_AutoTriggerHandler(void)
+{
+	u8 Local_u8Next=(ADC_RingHead+1)&(ADC_RING_SIZE-1);
+	if(Local_u8Next==ADC_RingTail)
+	{
+		/*ring full, the sample is lost*/
+		ADC_RingOverruns++;
+	}
+	else
+	{
+		ADC_Ring[ADC_RingHead]=ADC;
+		ADC_RingHead=Local_u8Next;
+	}
+	/*the ADC starts on the rising edge of the trigger flag, clear it to get the next trigger.
+	 *if the source has its own interrupt enabled its ISR already clears the flag, leave it to it.
+	 *the flag registers are written (not read-modify-write) so only this flag is cleared*/
+	switch(ADC_TriggerSource)
+	{
+		case ADC_TRIGGER_ANALOG_COMPARATOR:
+		if(!READ_BIT(ACSR,ACIE))
+		{
+			/*ACI is the only flag in ACSR, writing the read value back clears it alone*/
+			SET_BIT(ACSR,ACI);
+		}
+		break;
+		case ADC_TRIGGER_INT0:
+		if(!READ_BIT(GICR,INT0))
+		{
+			GIFR=(1<<INTF0);
+		}
+		break;
+		case ADC_TRIGGER_TIMER0_COMPARE:
+		if(!READ_BIT(TIMSK,OCIE0))
+		{
+			TIFR=(1<<OCF0);
+		}
+		break;
+		case ADC_TRIGGER_TIMER0_OVERFLOW:
+		if(!READ_BIT(TIMSK,TOIE0))
+		{
+			TIFR=(1<<TOV0);
+		}
+		break;
+		case ADC_TRIGGER_TIMER1_COMPAREB:
+		if(!READ_BIT(TIMSK,OCIE1B))
+		{
+			TIFR=(1<<OCF1B);
+		}
+		break;
+		case ADC_TRIGGER_TIMER1_OVERFLOW:
+		if(!READ_BIT(TIMSK,TOIE1))
+		{
+			TIFR=(1<<TOV1);
+		}
+		break;
+		case ADC_TRIGGER_TIMER1_CAPTURE:
+		if(!READ_BIT(TIMSK,TICIE1))
+		{
+			TIFR=(1<<ICF1);
+		}
+		break;
+		default:
+		/*free running retriggers on ADIF*/
+		break;
+	}
+}
+
+ISR(ADC_vect)
+{
+	if(ADC_IsrMode==ADC_ISR_AUTO_TRIGGER)
+	{
+		ADC_AutoTriggerHandler();
+	}
+	else
+	{
+		ADC_ScanHandler();
+	}
+}
@@ -4,6 +4,19 @@
 
 #define AREE    ((u16)3000)
 
+/*Channels converted by the scan engine, in order
+ *the index in this list is the index used with ADC_ScanGetReading*/
+#define ADC_SCAN_CHANNELS_NUMBER   2
+#define ADC_SCAN_CHANNELS          {CH_5,CH_7}
+
+/*ADC_SCAN_CONTINUOUS : restart after every scan
+ *ADC_SCAN_SINGLE     : one scan per ADC_ScanStart*/
+#define ADC_SCAN_MODE              ADC_SCAN_CONTINUOUS
+
+/*Samples kept by the auto trigger ring buffer, power of 2 and max 128
+ *(one place is kept empty so it holds ADC_RING_SIZE-1 samples)*/
+#define ADC_RING_SIZE              32
+
 
 
 #endif /* ADC_CFG_H_ */
\ No newline at end of file
@@ -29,10 +29,45 @@ typedef enum{
 	CH_7
 }ADC_Channel_type;
 
+/*values of ADTS2:0*/
+typedef enum{
+	ADC_TRIGGER_FREE_RUNNING=0,
+	ADC_TRIGGER_ANALOG_COMPARATOR,
+	ADC_TRIGGER_INT0,
+	ADC_TRIGGER_TIMER0_COMPARE,
+	ADC_TRIGGER_TIMER0_OVERFLOW,
+	ADC_TRIGGER_TIMER1_COMPAREB,
+	ADC_TRIGGER_TIMER1_OVERFLOW,
+	ADC_TRIGGER_TIMER1_CAPTURE
+}ADC_Trigger_type;
+
 void ADC_Init(ADC_VoltRef_type vref,ADC_Prescaler_type scaler);
 u16  ADC_Read(ADC_Channel_type channel);
 void ADC_StartConversion(ADC_Channel_type channel);
 u8 ADC_GetReadPeroidicCheck(u16*pdata);
 u16 ADC_GetReadNoBlock(void);
+u16 ADC_ReadVolt(ADC_Channel_type channel);
+u16 ADC_ConvertToVolt(u16 value);
+u8 ADC_Scale(u16 ADC_Value);
+
+/*Interrupt driven scan of the channels configured in ADC_Cfg.h*/
+#define ADC_SCAN_NOT_FOUND   0xFF
+
+void ADC_ScanStart(void);
+void ADC_ScanStop(void);
+void ADC_ScanSetCallBack(void(*LocalFptr)(void));
+const u16* ADC_ScanGetBuffer(void);
+u16 ADC_ScanGetReading(u8 Copy_u8Index);
+u8 ADC_ScanGetIndex(ADC_Channel_type channel);
+u8 ADC_ScanIsNewData(void);
+
+/*Hardware triggered sampling of one channel at a fixed rate*/
+void ADC_AutoTriggerStart(ADC_Channel_type channel,ADC_Trigger_type trigger);
+void ADC_AutoTriggerStop(void);
+u8 ADC_AutoTriggerAvailable(void);
+/*copies Size samples out of the ring, OK when copied, OUTOFRANGE if fewer samples are buffered yet,
+ *NOK if Size is 0 or above ADC_RING_SIZE-1 (the ring can never hold that many)*/
+Error_t ADC_AutoTriggerReadBlock(u16*Copy_pu16Block,u8 Copy_u8Size);
+u16 ADC_AutoTriggerGetOverruns(void);
 
 #endif /* ADC_INTERFACE_H_ */
\ No newline at end of file
@@ -3,6 +3,28 @@
 #ifndef ADC_PRIVATE_H_
 #define ADC_PRIVATE_H_
 
+#define ADC_SCAN_SINGLE       0
+#define ADC_SCAN_CONTINUOUS   1
+
+/*one buffer filled by the ISR while the other one holds the last complete scan*/
+#define ADC_SCAN_BUFFERS      2
+
+#define ADC_ISR_SCAN          0
+#define ADC_ISR_AUTO_TRIGGER  1
+
+/*Q16 multipliers used instead of float division
+ *ADC_VOLT_Q16 : millivolt per step = vref/1024 (exact, vref*64)
+ *ADC_SCALE_Q16: 100/1023 rounded to nearest (6406.256 -> 6406)
+ *ADC_SCALE_BIAS: gives back the 0.256*1023=262 lost at full scale, with it every code 0..1023
+ *                matches the truncated float result exactly (any bias from 262 to 291 does)*/
+#define ADC_Q16_SHIFT         16
+#define ADC_VOLT_Q16(VREF_MV) ((((u32)(VREF_MV))<<ADC_Q16_SHIFT)/1024)
+#define ADC_SCALE_Q16         6406UL
+#define ADC_SCALE_BIAS        276UL
+
+static void ADC_ScanHandler(void);
+static void ADC_AutoTriggerHandler(void);
+
 
 
 
@@ -54,6 +54,7 @@ typedef enum{
 
 
 void DIO_Init(void);
+void DIO_SetPinStatus(DIO_Pin_type pin,DIO_PinStatus_type status);
 
 //void DIO_InitPin3(DIO_Pin_type pin,DIO_PinStatus_type status);
 //void DIO_InitPin2(DIO_Port_type port,u8 pin_num,DIO_PinStatus_type status);
@@ -69,6 +70,8 @@ DIO_PinVoltage_type DIO_ReadPin(DIO_Pin_type pin);
 void DIO_TogglePin(DIO_Pin_type pin);
 
 void DIO_WritePort(DIO_Port_type port,u8 value);
+/*writes only the pins set in mask , the other pins keep their value*/
+void DIO_WritePortMasked(DIO_Port_type port,u8 mask,u8 value);
 
 u8 DIO_ReadPort(DIO_Port_type port);
 
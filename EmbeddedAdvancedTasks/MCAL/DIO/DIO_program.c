@@ -18,6 +18,15 @@ void DIO_Init(void)
 	
 }
 
+/*change the direction of one pin at runtime (ex: LCD data pins read for the busy flag)*/
+void DIO_SetPinStatus(DIO_Pin_type pin,DIO_PinStatus_type status)
+{
+	if(pin<TOTAL_PINS)
+	{
+		DIO_InitPin(pin,status);
+	}
+}
+
 static void DIO_InitPin(DIO_Pin_type pin,DIO_PinStatus_type status)
 {
 	DIO_Port_type port =pin/8;
@@ -475,6 +484,29 @@ void DIO_WritePort(DIO_Port_type port,u8 value)
 		break;
 	}
 }
+
+void DIO_WritePortMasked(DIO_Port_type port,u8 mask,u8 value)
+{
+	/*read modify write , an ISR writing the same port must not come in the middle*/
+	u8 sreg=SREG;
+	cli();
+	switch(port)
+	{
+		case PA:
+		PORTA=(PORTA&~mask)|(value&mask);
+		break;
+		case PB:
+		PORTB=(PORTB&~mask)|(value&mask);
+		break;
+		case PC:
+		PORTC=(PORTC&~mask)|(value&mask);
+		break;
+		case PD:
+		PORTD=(PORTD&~mask)|(value&mask);
+		break;
+	}
+	SREG=sreg;
+}
 u8 DIO_ReadPort(DIO_Port_type port)
 {
 	u8 value=0;
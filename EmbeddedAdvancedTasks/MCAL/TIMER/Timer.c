@@ -17,6 +17,12 @@ static void (*Timer1_OVF_Fptr) (void)=NULLPTR;
 static void (*Timer1_OCA_Fptr) (void)=NULLPTR;
 static void (*Timer1_OCB_Fptr) (void)=NULLPTR;
 static void (*Timer1_ICU_Fptr) (void)=NULLPTR;
+// Timer2
+static void (*Timer2_OVF_Fptr) (void)=NULLPTR;
+static void (*Timer2_OC_Fptr) (void)=NULLPTR;
+// Timer2 RTC seconds
+static volatile u32 Timer2_RTC_Seconds=0;
+static volatile u8 Timer2_RTC_Running=0;
 /******************************************************************************************/
 /*timer 0 functions*/
 void TIMER0_Init(Timer0Mode_type mode,Timer0Scaler_type scaler)
@@ -296,6 +302,8 @@ ISR(TIMER1_ICU_vect)
 /*********************************Timer2*********************************************/
 void TIMER2_Init(Timer2Mode_type mode,Timer2Scaler_type scaler)
 {
+	/*any other configuration of the timer ends the RTC mode*/
+	Timer2_RTC_Running=0;
 	switch (mode)
 	{
 		case TIMER2_NORMAL_MODE:
@@ -345,4 +353,171 @@ void TIMER2_OC0Mode(OCR2Mode_type mode)
 void TIMER2_OV_InterruptEnable(void)
 {
 	SET_BIT(TIMSK,TOIE2);
+}
+void TIMER2_OV_InterruptDisable(void)
+{
+	CLR_BIT(TIMSK,TOIE2);
+}
+void TIMER2_OC_InterruptEnable(void)
+{
+	SET_BIT(TIMSK,OCIE2);
+}
+void TIMER2_OC_InterruptDisable(void)
+{
+	CLR_BIT(TIMSK,OCIE2);
+}
+
+/****************************Timer 2 asynchronous mode (32.768KHz crystal on TOSC1/TOSC2)*******************************/
+void TIMER2_AsyncInit(Timer2Mode_type mode,Timer2Scaler_type scaler)
+{
+	/*data sheet sequence : interrupts off , switch the clock , write the registers , wait the update , clear the flags*/
+	u8 Local_u8Interrupts=TIMSK&((1<<OCIE2)|(1<<TOIE2));
+	TIMSK&=~((1<<OCIE2)|(1<<TOIE2));
+	SET_BIT(ASSR,AS2);
+	TCNT2=0;
+	TIMER2_Init(mode,scaler);
+	TIMER2_AsyncWait();
+	TIFR=(1<<OCF2)|(1<<TOV2);
+	TIMSK|=Local_u8Interrupts;
+}
+
+void TIMER2_AsyncWait(void)
+{
+	/*registers written in async mode take 2 crystal cycles to reach the timer*/
+	while(ASSR&((1<<TCN2UB)|(1<<OCR2UB)|(1<<TCR2UB)));
+}
+
+/****************************Timer 2 RTC**************************************/
+void TIMER2_RTC_Init(void)
+{
+	/*32768Hz/128=256Hz --> overflow every 1 second*/
+	Timer2_RTC_Seconds=0;
+	TIMER2_AsyncInit(TIMER2_NORMAL_MODE,TIMER2_RTC_SCALER);
+	Timer2_RTC_Running=1;
+	TIMER2_OV_InterruptEnable();
+}
+
+u32 TIMER2_RTC_GetSeconds(void)
+{
+	u32 Local_u32Seconds;
+	u8 sreg=SREG;
+	cli();
+	Local_u32Seconds=Timer2_RTC_Seconds;
+	SREG=sreg;
+	return Local_u32Seconds;
+}
+
+void TIMER2_RTC_SetSeconds(u32 seconds)
+{
+	u8 sreg=SREG;
+	cli();
+	Timer2_RTC_Seconds=seconds;
+	SREG=sreg;
+}
+
+/*********************************Timer 2 Call Back functions*****************************************/
+
+void TIMER2_OV_SetCallBack(void(*LocalFptr)(void))
+{
+	Timer2_OVF_Fptr=LocalFptr;
+}
+void TIMER2_OC_SetCallBack(void(*LocalFptr)(void))
+{
+	Timer2_OC_Fptr=LocalFptr;
+}
+
+ISR(TIMER2_OVF_vect)
+{
+	/*in RTC mode every overflow is one second, the call back still runs (ex: wake up tasks)*/
+	if(Timer2_RTC_Running)
+	{
+		Timer2_RTC_Seconds++;
+	}
+	if(Timer2_OVF_Fptr!=NULLPTR)
+	{
+		Timer2_OVF_Fptr();
+	}
+}
+ISR(TIMER2_COMP_vect)
+{
+	if(Timer2_OC_Fptr!=NULLPTR)
+	{
+		Timer2_OC_Fptr();
+	}
+}
+
+/*********************************Period solver*********************************************/
+Error_t Timer_ConfigurePeriod(Timer_type timer,u32 period_us,Timer_Period_type*result)
+{
+	static const u8 Timer01_Shifts[TIMER01_SCALERS_NUMBER]=TIMER01_SCALER_SHIFTS;
+	static const u8 Timer2_Shifts[TIMER2_SCALERS_NUMBER]=TIMER2_SCALER_SHIFTS;
+	const u8*Local_pu8Shifts=Timer01_Shifts;
+	u8 Local_u8ScalersNumber=TIMER01_SCALERS_NUMBER;
+	u32 Local_u32MaxCounts=TIMER_8BIT_COUNTS;
+	u32 Local_u32Cycles,Local_u32Counts=0,Local_u32Achieved;
+	u8 Local_u8Index;
+	Error_t Local_Status=OUTOFRANGE;
+
+	if(timer==TIMER_1)
+	{
+		Local_u32MaxCounts=TIMER_16BIT_COUNTS;
+	}
+	else if(timer==TIMER_2)
+	{
+		Local_pu8Shifts=Timer2_Shifts;
+		Local_u8ScalersNumber=TIMER2_SCALERS_NUMBER;
+	}
+	/*longest period of Timer1 is 8.4s, the cycles fit 32 bit*/
+	if((timer<=TIMER_2)&&(period_us>0)&&(period_us<=(TIMER_16BIT_COUNTS*1024UL)/TIMER_CLOCK_MHZ))
+	{
+		Local_u32Cycles=period_us*TIMER_CLOCK_MHZ;
+		for(Local_u8Index=0;Local_u8Index<Local_u8ScalersNumber;Local_u8Index++)
+		{
+			/*rounded counts = cycles/prescaler*/
+			Local_u32Counts=(Local_u32Cycles+((1UL<<Local_pu8Shifts[Local_u8Index])>>1))>>Local_pu8Shifts[Local_u8Index];
+			if(Local_u32Counts<=Local_u32MaxCounts)
+			{
+				Local_Status=OK;
+				break;
+			}
+		}
+	}
+	if(Local_Status==OK)
+	{
+		if(Local_u32Counts==0)
+		{
+			Local_u32Counts=1;
+		}
+		Timer_SetPeriod(timer,Local_u8Index+1,(u16)(Local_u32Counts-1));
+		if(result!=NULLPTR)
+		{
+			Local_u32Achieved=Local_u32Counts<<Local_pu8Shifts[Local_u8Index];
+			result->Scaler=Local_u8Index+1;
+			result->Top=(u16)(Local_u32Counts-1);
+			result->PeriodUs=(Local_u32Achieved+(TIMER_CLOCK_MHZ/2))/TIMER_CLOCK_MHZ;
+			/*the difference is less than half a prescaler (512 cycles) so *1000000 fits s32*/
+			result->ErrorPpm=(((s32)Local_u32Achieved-(s32)Local_u32Cycles)*1000000L)/(s32)Local_u32Cycles;
+		}
+	}
+	return Local_Status;
+}
+
+void Timer_SetPeriod(Timer_type timer,u8 scaler,u16 top)
+{
+	/*TOP first, the timer starts counting with the prescaler*/
+	switch(timer)
+	{
+		case TIMER_0:
+		OCR0=(u8)top;
+		TIMER0_Init(TIMER0_CTC_MODE,(Timer0Scaler_type)scaler);
+		break;
+		case TIMER_1:
+		OCR1A=top;
+		Timer1_Init(TIMER1_CTC_OCRA_TOP_MODE,(Timer1Scaler_type)scaler);
+		break;
+		case TIMER_2:
+		OCR2=(u8)top;
+		TIMER2_Init(TIMER2_CTC_MODE,(Timer2Scaler_type)scaler);
+		break;
+	}
 }
\ No newline at end of file
@@ -3,6 +3,12 @@
 #ifndef TIMER_CFG_H_
 #define TIMER_CFG_H_
 
+/*timers clock before the prescaler (F_CPU 8MHz)*/
+#define TIMER_CLOCK_MHZ     8
+
+/*32768Hz crystal / 128 / 256 counts = 1 overflow per second*/
+#define TIMER2_RTC_SCALER   TIMER2_SCALER_128
+
 
 
 
@@ -4,6 +4,8 @@
 #ifndef TIMER_INTERFACE_H_
 #define TIMER_INTERFACE_H_
 
+#include "Timer_Cfg.h"
+
 
 /*************************************Timer0********************************************************/
 typedef enum{
@@ -44,6 +46,7 @@ void TIMER0_OV_InterruptDisable(void);
 void TIMER0_OC_InterruptEnable(void);
 void TIMER0_OC_InterruptDisable(void);
 void TIMER0_OV_SetCallBack(void(*local_fptr)(void));
+void TIMER0_OC_SetCallBack(void(*local_fptr)(void));
 
 /*************************************Timer1********************************************************/
 
@@ -153,6 +156,81 @@ void TIMER2_Init(Timer2Mode_type mode,Timer2Scaler_type scaler);
 
 void TIMER2_OC0Mode(OCR2Mode_type mode);
 void TIMER2_OV_InterruptEnable(void);
+void TIMER2_OV_InterruptDisable(void);
+void TIMER2_OC_InterruptEnable(void);
+void TIMER2_OC_InterruptDisable(void);
+void TIMER2_OV_SetCallBack(void(*LocalFptr)(void));
+void TIMER2_OC_SetCallBack(void(*LocalFptr)(void));
+
+/*asynchronous mode : Timer2 clocked from a 32.768KHz crystal on TOSC1/TOSC2 (PINC6/PINC7)
+ *it keeps counting in power save sleep, call TIMER2_AsyncWait after writing TCNT2/OCR2/TCCR2
+ *and before going to sleep*/
+void TIMER2_AsyncInit(Timer2Mode_type mode,Timer2Scaler_type scaler);
+void TIMER2_AsyncWait(void);
+
+/*RTC : async normal mode with overflow every second, counts the seconds in the overflow ISR
+ *TIMER2_OV_SetCallBack can still be used to run a task every second
+ *seconds are counted only after TIMER2_RTC_Init, a later TIMER2_Init or TIMER2_AsyncInit stops the count*/
+void TIMER2_RTC_Init(void);
+u32 TIMER2_RTC_GetSeconds(void);
+void TIMER2_RTC_SetSeconds(u32 seconds);
+
+/*************************************Period solver*************************************************/
+typedef enum{
+	TIMER_0=0,
+	TIMER_1,
+	TIMER_2
+}Timer_type;
+
+typedef struct{
+	u8  Scaler;      /*Timer0/1/2 scaler_type value*/
+	u16 Top;         /*OCR0/OCR1A/OCR2 value in CTC mode*/
+	u32 PeriodUs;    /*achieved period rounded to us*/
+	s32 ErrorPpm;    /*(achieved-requested)/requested in part per million*/
+}Timer_Period_type;
+
+/*runtime : picks the smallest prescaler that fits (best resolution), starts the timer in CTC mode
+ *and fills result (can be NULLPTR), OUTOFRANGE if the period can't be done by this timer*/
+Error_t Timer_ConfigurePeriod(Timer_type timer,u32 period_us,Timer_Period_type*result);
+/*applies a prescaler and TOP already computed by the TIMERx_PERIOD_ macros*/
+void Timer_SetPeriod(Timer_type timer,u8 scaler,u16 top);
+
+/*compile time : the same choice folded by the compiler when US is a constant
+ *ex: TIMER1_CONFIGURE_PERIOD(20000) --> TIMER1_SCALER_8 , OCR1A=19999
+ *a period out of the timer range stops the build (the TOP cast would truncate it),
+ *US must be a constant : runtime values go through Timer_ConfigurePeriod which returns OUTOFRANGE
+ *all the prescalers are powers of 2 so the counts are a shift of the timer clock cycles*/
+#define TIMER_PERIOD_COUNTS(US,SHIFT)  ((((u32)(US)*TIMER_CLOCK_MHZ)+((1UL<<(SHIFT))>>1))>>(SHIFT))
+
+#define TIMER0_PERIOD_SHIFT(US)   (TIMER_PERIOD_COUNTS(US,0)<=256UL?0:TIMER_PERIOD_COUNTS(US,3)<=256UL?3:\
+                                   TIMER_PERIOD_COUNTS(US,6)<=256UL?6:TIMER_PERIOD_COUNTS(US,8)<=256UL?8:10)
+#define TIMER0_PERIOD_SCALER(US)  (TIMER0_PERIOD_SHIFT(US)==0?TIMER0_SCALER_1:TIMER0_PERIOD_SHIFT(US)==3?TIMER0_SCALER_8:\
+                                   TIMER0_PERIOD_SHIFT(US)==6?TIMER0_SCALER_64:TIMER0_PERIOD_SHIFT(US)==8?TIMER0_SCALER_256:TIMER0_SCALER_1024)
+#define TIMER0_PERIOD_TOP(US)     ((u8)(TIMER_PERIOD_COUNTS(US,TIMER0_PERIOD_SHIFT(US))-1))
+#define TIMER0_PERIOD_VALID(US)   ((TIMER_PERIOD_COUNTS(US,0)>=1)&&(TIMER_PERIOD_COUNTS(US,10)<=256UL))
+
+#define TIMER1_PERIOD_SHIFT(US)   (TIMER_PERIOD_COUNTS(US,0)<=65536UL?0:TIMER_PERIOD_COUNTS(US,3)<=65536UL?3:\
+                                   TIMER_PERIOD_COUNTS(US,6)<=65536UL?6:TIMER_PERIOD_COUNTS(US,8)<=65536UL?8:10)
+#define TIMER1_PERIOD_SCALER(US)  (TIMER1_PERIOD_SHIFT(US)==0?TIMER1_SCALER_1:TIMER1_PERIOD_SHIFT(US)==3?TIMER1_SCALER_8:\
+                                   TIMER1_PERIOD_SHIFT(US)==6?TIMER1_SCALER_64:TIMER1_PERIOD_SHIFT(US)==8?TIMER1_SCALER_256:TIMER1_SCALER_1024)
+#define TIMER1_PERIOD_TOP(US)     ((u16)(TIMER_PERIOD_COUNTS(US,TIMER1_PERIOD_SHIFT(US))-1))
+#define TIMER1_PERIOD_VALID(US)   ((TIMER_PERIOD_COUNTS(US,0)>=1)&&(TIMER_PERIOD_COUNTS(US,10)<=65536UL))
+
+#define TIMER2_PERIOD_SHIFT(US)   (TIMER_PERIOD_COUNTS(US,0)<=256UL?0:TIMER_PERIOD_COUNTS(US,3)<=256UL?3:\
+                                   TIMER_PERIOD_COUNTS(US,5)<=256UL?5:TIMER_PERIOD_COUNTS(US,6)<=256UL?6:\
+                                   TIMER_PERIOD_COUNTS(US,7)<=256UL?7:TIMER_PERIOD_COUNTS(US,8)<=256UL?8:10)
+#define TIMER2_PERIOD_SCALER(US)  (TIMER2_PERIOD_SHIFT(US)==0?TIMER2_SCALER_1:TIMER2_PERIOD_SHIFT(US)==3?TIMER2_SCALER_8:\
+                                   TIMER2_PERIOD_SHIFT(US)==5?TIMER2_SCALER_32:TIMER2_PERIOD_SHIFT(US)==6?TIMER2_SCALER_64:\
+                                   TIMER2_PERIOD_SHIFT(US)==7?TIMER2_SCALER_128:TIMER2_PERIOD_SHIFT(US)==8?TIMER2_SCALER_256:TIMER2_SCALER_1024)
+#define TIMER2_PERIOD_TOP(US)     ((u8)(TIMER_PERIOD_COUNTS(US,TIMER2_PERIOD_SHIFT(US))-1))
+#define TIMER2_PERIOD_VALID(US)   ((TIMER_PERIOD_COUNTS(US,0)>=1)&&(TIMER_PERIOD_COUNTS(US,10)<=256UL))
+
+#define TIMER0_CONFIGURE_PERIOD(US)  do{_Static_assert(TIMER0_PERIOD_VALID(US),"Timer0 period out of range");\
+                                      Timer_SetPeriod(TIMER_0,TIMER0_PERIOD_SCALER(US),TIMER0_PERIOD_TOP(US));}while(0)
+#define TIMER1_CONFIGURE_PERIOD(US)  do{_Static_assert(TIMER1_PERIOD_VALID(US),"Timer1 period out of range");\
+                                      Timer_SetPeriod(TIMER_1,TIMER1_PERIOD_SCALER(US),TIMER1_PERIOD_TOP(US));}while(0)
+#define TIMER2_CONFIGURE_PERIOD(US)  do{_Static_assert(TIMER2_PERIOD_VALID(US),"Timer2 period out of range");\
+                                      Timer_SetPeriod(TIMER_2,TIMER2_PERIOD_SCALER(US),TIMER2_PERIOD_TOP(US));}while(0)
 
 
 #endif /* TIMERS_INTERFACE_H_ */
\ No newline at end of file
@@ -3,6 +3,15 @@
 #ifndef TIMER_PRIVATE_H_
 #define TIMER_PRIVATE_H_
 
+/*prescalers as shifts (all are powers of 2), index+1 is the scaler_type value*/
+#define TIMER01_SCALERS_NUMBER   5
+#define TIMER01_SCALER_SHIFTS    {0,3,6,8,10}
+#define TIMER2_SCALERS_NUMBER    7
+#define TIMER2_SCALER_SHIFTS     {0,3,5,6,7,8,10}
+
+#define TIMER_8BIT_COUNTS        256UL
+#define TIMER_16BIT_COUNTS       65536UL
+
 
 
 
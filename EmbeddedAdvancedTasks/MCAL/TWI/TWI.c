@@ -6,14 +6,20 @@
 #include "TWI_Private.h"
 #include "TWI_Cfg.h"
 
+#define F_CPU  8000000
+#include <util/delay.h>
+
+/*Running transaction of the interrupt driven master*/
+static TWI_Transaction_type TWI_Transaction;
+static volatile TWI_State_type TWI_State=TWI_IDLE;
+static volatile u8 TWI_TxIndex=0;
+static volatile u8 TWI_RxIndex=0;
+static volatile u8 TWI_TimeoutCounter=0;
+
 void TWI_voidMasterInit(u8 Copu_u8SlaveAddress)
 {
-	/*Set clock frequency to 400kbps*/
-	/*1-Set TWBR to 2*/
-	TWBR=2;
-	/*2-Clear the 2 bits of TWPS*/
-	CLR_BIT(TWCR,TWPS0);
-	CLR_BIT(TWCR,TWPS1);
+	/*Set clock frequency from the configured bit rate (TWBR and TWPS computed from F_CPU)*/
+	TWI_SetBitrate(TWI_BITRATE);
 	TWAR = 0b00000010;
 	/*Initialize the node address*/
 	if(Copu_u8SlaveAddress!=0)
@@ -23,6 +29,40 @@ void TWI_voidMasterInit(u8 Copu_u8SlaveAddress)
 	/*Enable TWI*/
 	SET_BIT(TWCR,TWEN);
 }
+u32 TWI_SetBitrate(u32 Copy_u32BitrateHz)
+{
+	/*SCL frequency = F_CPU/(16+2*TWBR*4^TWPS)
+	 *--> TWBR=(F_CPU-16*SCL)/(2*SCL*4^TWPS)
+	 *try the prescalers from the smallest one (best resolution) until TWBR fits in 8 bits
+	 *TWBR is rounded up so the achieved rate never exceeds the requested one */
+	u32 Local_u32AchievedHz=0;
+	u32 Local_u32Numerator,Local_u32Denominator,Local_u32TWBR;
+	u8 Local_u8Prescaler;
+	if((Copy_u32BitrateHz!=0)&&(Copy_u32BitrateHz<=TWI_MAX_BITRATE)&&(Copy_u32BitrateHz<=(F_CPU/16)))
+	{
+		Local_u32Numerator=(u32)F_CPU-(16*Copy_u32BitrateHz);
+		for(Local_u8Prescaler=0;Local_u8Prescaler<TWI_PRESCALER_NUMBERS;Local_u8Prescaler++)
+		{
+			/*4^TWPS=1<<(2*TWPS)*/
+			Local_u32Denominator=(2*Copy_u32BitrateHz)<<(2*Local_u8Prescaler);
+			Local_u32TWBR=(Local_u32Numerator+Local_u32Denominator-1)/Local_u32Denominator;
+			if(Local_u32TWBR<=TWI_MAX_TWBR)
+			{
+				if(Local_u32TWBR<TWI_MIN_TWBR)
+				{
+					Local_u32TWBR=TWI_MIN_TWBR;
+				}
+				TWBR=(u8)Local_u32TWBR;
+				/*TWPS bits are in TWSR not TWCR*/
+				TWSR=(TWSR&~((1<<TWPS1)|(1<<TWPS0)))|Local_u8Prescaler;
+				Local_u32AchievedHz=(u32)F_CPU/(16+((2*Local_u32TWBR)<<(2*Local_u8Prescaler)));
+				break;
+			}
+		}
+	}
+	/*0 means the requested rate can't be generated, the registers are not changed*/
+	return Local_u32AchievedHz;
+}
 void TWI_voidSlaveInit(u8 Copu_u8SlaveAddress)
 {
 	/*Initialize the node address*/
@@ -175,6 +215,30 @@ TWI_ErrStatus TWI_MasterReadDataByte(u8*Copy_u8DataByte)
 	
 	return Local_ErrStatus;
 }
+TWI_ErrStatus TWI_MasterReadDataByteNack(u8*Copy_u8DataByte)
+{
+	TWI_ErrStatus Local_ErrStatus=NoError;
+	/*Disable master generation acknowledge bit, NACK tells the slave this is the last byte*/
+	CLR_BIT(TWCR,TWEA);
+	
+	/*Clear the interrupt flag to start the previous operation*/
+	SET_BIT(TWCR,TWINT);
+	
+	/*Wait until the interrupt flag is raised again and the previous operation is completed*/
+	while(READ_BIT(TWCR,TWINT)==0);
+	/*Check the operation status in the status register*/
+	if((TWSR &0XF8)!=TWI_MR_DATA_NACK)
+	{
+		Local_ErrStatus=MasterReadByteErr;
+	}
+	else
+	{
+		/*Read the received data*/
+		*Copy_u8DataByte=TWDR;
+	}
+	
+	return Local_ErrStatus;
+}
 void TWI_SendStopCondition(void)
 {
 	/*Generate stop condition on the bus*/
@@ -183,3 +247,250 @@ void TWI_SendStopCondition(void)
 	/*Clear the interrupt flag to start the previous operation*/
 	SET_BIT(TWCR,TWINT);
 }
+
+/*********************************Burst transfers*********************************************/
+TWI_ErrStatus TWI_WriteBurst(u8 Copy_u8SlaveAddress,u8 Copy_u8Register,const u8*Copy_pu8Data,u16 Copy_u16Length)
+{
+	u16 Local_u16Iterator;
+	TWI_ErrStatus Local_ErrStatus=TWI_SendStartCondition();
+	if(Local_ErrStatus==NoError)
+	{
+		Local_ErrStatus=TWI_SendSlaveAddressWithWrite(Copy_u8SlaveAddress);
+	}
+	if(Local_ErrStatus==NoError)
+	{
+		Local_ErrStatus=TWI_MasterWriteDataByte(Copy_u8Register);
+	}
+	/*All the bytes go in the same transaction, the slave increments its register pointer*/
+	for(Local_u16Iterator=0;(Local_u16Iterator<Copy_u16Length)&&(Local_ErrStatus==NoError);Local_u16Iterator++)
+	{
+		Local_ErrStatus=TWI_MasterWriteDataByte(Copy_pu8Data[Local_u16Iterator]);
+	}
+	/*Stop also on error so the bus is released*/
+	TWI_SendStopCondition();
+	return Local_ErrStatus;
+}
+
+TWI_ErrStatus TWI_ReadBurst(u8 Copy_u8SlaveAddress,u8 Copy_u8Register,u8*Copy_pu8Data,u16 Copy_u16Length)
+{
+	u16 Local_u16Iterator;
+	TWI_ErrStatus Local_ErrStatus=TWI_SendStartCondition();
+	if(Local_ErrStatus==NoError)
+	{
+		Local_ErrStatus=TWI_SendSlaveAddressWithWrite(Copy_u8SlaveAddress);
+	}
+	if(Local_ErrStatus==NoError)
+	{
+		Local_ErrStatus=TWI_MasterWriteDataByte(Copy_u8Register);
+	}
+	if((Local_ErrStatus==NoError)&&(Copy_u16Length!=0))
+	{
+		Local_ErrStatus=TWI_SendRepeatedStart();
+		if(Local_ErrStatus==NoError)
+		{
+			Local_ErrStatus=TWI_SendSlaveAddressWithRead(Copy_u8SlaveAddress);
+		}
+		/*ACK every byte except the last one*/
+		for(Local_u16Iterator=0;(Local_u16Iterator<(Copy_u16Length-1))&&(Local_ErrStatus==NoError);Local_u16Iterator++)
+		{
+			Local_ErrStatus=TWI_MasterReadDataByte(&Copy_pu8Data[Local_u16Iterator]);
+		}
+		if(Local_ErrStatus==NoError)
+		{
+			Local_ErrStatus=TWI_MasterReadDataByteNack(&Copy_pu8Data[Copy_u16Length-1]);
+		}
+	}
+	TWI_SendStopCondition();
+	return Local_ErrStatus;
+}
+
+/*********************************Interrupt driven master*********************************************/
+TWI_ErrStatus TWI_StartTransaction(const TWI_Transaction_type*Copy_pTransaction)
+{
+	TWI_ErrStatus Local_ErrStatus=NoError;
+	if((Copy_pTransaction==NULLPTR)
+		||((Copy_pTransaction->TxLength==0)&&(Copy_pTransaction->RxLength==0))
+		||((Copy_pTransaction->TxLength!=0)&&(Copy_pTransaction->TxBuffer==NULLPTR))
+		||((Copy_pTransaction->RxLength!=0)&&(Copy_pTransaction->RxBuffer==NULLPTR)))
+	{
+		/*Nothing to transfer or a missing buffer, the ISR would read into/write from address 0*/
+		Local_ErrStatus=TransactionParamErr;
+	}
+	else if(TWI_State==TWI_BUSY)
+	{
+		Local_ErrStatus=TransactionBusyErr;
+	}
+	else
+	{
+		/*Take a copy so the caller descriptor can be a local variable*/
+		TWI_Transaction=*Copy_pTransaction;
+		TWI_TxIndex=0;
+		TWI_RxIndex=0;
+		TWI_TimeoutCounter=0;
+		TWI_State=TWI_BUSY;
+		/*Send start condition, the rest of the transaction is done in the ISR*/
+		TWCR=TWI_CMD_START;
+	}
+	return Local_ErrStatus;
+}
+
+u8 TWI_IsBusy(void)
+{
+	return (TWI_State==TWI_BUSY);
+}
+
+void TWI_TimeoutTick(void)
+{
+	/*must be called periodically (ex: from a timer call back), every TWI interrupt clears the counter*/
+	u8 Local_u8Sreg=SREG;
+	/*TWI interrupt must not finish the transaction between the check and the time out*/
+	cli();
+	if(TWI_State==TWI_BUSY)
+	{
+		TWI_TimeoutCounter++;
+		if(TWI_TimeoutCounter>=TWI_TIMEOUT_TICKS)
+		{
+			TWI_BusRecovery();
+			TWI_FinishTransaction(BusTimeoutErr);
+		}
+	}
+	SREG=Local_u8Sreg;
+}
+
+void TWI_BusRecovery(void)
+{
+	u8 Local_u8Iterator;
+	/*Disable TWI so SCL and SDA return to normal port pins*/
+	TWCR=0;
+	/*Release SDA and clock SCL up to 9 times so a slave holding SDA low finishes its byte*/
+	CLR_BIT(DDRC,TWI_SDA_PIN);
+	CLR_BIT(PORTC,TWI_SDA_PIN);
+	CLR_BIT(PORTC,TWI_SCL_PIN);
+	for(Local_u8Iterator=0;Local_u8Iterator<TWI_RECOVERY_CLOCKS;Local_u8Iterator++)
+	{
+		if(READ_BIT(PINC,TWI_SDA_PIN)==1)
+		{
+			break;
+		}
+		/*open drain: output low to pull SCL down, input to release it*/
+		SET_BIT(DDRC,TWI_SCL_PIN);
+		_delay_us(5);
+		CLR_BIT(DDRC,TWI_SCL_PIN);
+		_delay_us(5);
+	}
+	/*Enable TWI again and generate a stop condition to reset the slaves state machine*/
+	TWCR=(1<<TWEN);
+	TWCR=TWI_CMD_STOP;
+}
+
+static void TWI_FinishTransaction(TWI_ErrStatus Copy_ErrStatus)
+{
+	TWI_State=TWI_IDLE;
+	if(TWI_Transaction.CallBack!=NULLPTR)
+	{
+		TWI_Transaction.CallBack(Copy_ErrStatus);
+	}
+}
+
+ISR(TWI_vect)
+{
+	TWI_TimeoutCounter=0;
+	switch(TWSR&TWI_STATUS_MASK)
+	{
+		case TWI_START:
+		/*Write phase first, or direct read if there is nothing to write*/
+		if(TWI_Transaction.TxLength!=0)
+		{
+			TWDR=TWI_Transaction.SlaveAddress<<1;
+		}
+		else
+		{
+			TWDR=(TWI_Transaction.SlaveAddress<<1)|1;
+		}
+		TWCR=TWI_CMD_SEND;
+		break;
+		
+		case TWI_REP_START:
+		TWDR=(TWI_Transaction.SlaveAddress<<1)|1;
+		TWCR=TWI_CMD_SEND;
+		break;
+		
+		case TWI_MT_SLA_W_ACK:
+		case TWI_MT_DATA_ACK:
+		if(TWI_TxIndex<TWI_Transaction.TxLength)
+		{
+			TWDR=TWI_Transaction.TxBuffer[TWI_TxIndex];
+			TWI_TxIndex++;
+			TWCR=TWI_CMD_SEND;
+		}
+		else if(TWI_Transaction.RxLength!=0)
+		{
+			TWCR=TWI_CMD_START;
+		}
+		else
+		{
+			TWCR=TWI_CMD_STOP;
+			TWI_FinishTransaction(NoError);
+		}
+		break;
+		
+		case TWI_MT_SLA_R_ACK:
+		/*the last (or the only) byte must be NACKed*/
+		if(TWI_Transaction.RxLength>1)
+		{
+			TWCR=TWI_CMD_READ_ACK;
+		}
+		else
+		{
+			TWCR=TWI_CMD_READ_NACK;
+		}
+		break;
+		
+		case TWI_MR_DATA_ACK:
+		TWI_Transaction.RxBuffer[TWI_RxIndex]=TWDR;
+		TWI_RxIndex++;
+		if(TWI_RxIndex<(TWI_Transaction.RxLength-1))
+		{
+			TWCR=TWI_CMD_READ_ACK;
+		}
+		else
+		{
+			TWCR=TWI_CMD_READ_NACK;
+		}
+		break;
+		
+		case TWI_MR_DATA_NACK:
+		TWI_Transaction.RxBuffer[TWI_RxIndex]=TWDR;
+		TWI_RxIndex++;
+		TWCR=TWI_CMD_STOP;
+		TWI_FinishTransaction(NoError);
+		break;
+		
+		case TWI_MT_SLA_W_NACK:
+		TWCR=TWI_CMD_STOP;
+		TWI_FinishTransaction(SlaveAddressWithWriteErr);
+		break;
+		
+		case TWI_MT_DATA_NACK:
+		TWCR=TWI_CMD_STOP;
+		TWI_FinishTransaction(MasterWriteByteErr);
+		break;
+		
+		case TWI_MR_SLA_R_NACK:
+		TWCR=TWI_CMD_STOP;
+		TWI_FinishTransaction(SlaveAddressWithReadErr);
+		break;
+		
+		case TWI_ARB_LOST:
+		/*another master owns the bus, release it without stop*/
+		TWCR=TWI_CMD_RELEASE;
+		TWI_FinishTransaction(ArbitrationLostErr);
+		break;
+		
+		default:
+		/*Bus error or unexpected status*/
+		TWCR=TWI_CMD_STOP;
+		TWI_FinishTransaction(BusErr);
+		break;
+	}
+}
@@ -9,8 +9,19 @@
 #ifndef TWI_CFG_H_
 #define TWI_CFG_H_
 
+/* Number of TWI_TimeoutTick() calls without any bus progress before the
+ * running transaction is aborted and the bus recovery is done
+ * ex: TWI_TimeoutTick() called every 1ms --> 10ms timeout */
+#define TWI_TIMEOUT_TICKS    10
 
+/* SCL frequency set by TWI_voidMasterInit (100000 standard mode : 400000 fast mode) */
+#define TWI_BITRATE          100000UL
 
+/* Smallest TWBR value used by TWI_SetBitrate, the data sheet asks for TWBR>=10
+ * in master mode so with F_CPU=8MHz 400KHz is clamped to 222KHz,
+ * reduce it (min 0) only if the slaves are known to work with it */
+#define TWI_MIN_TWBR         10
 
 
-#endif /* TWI_CFG_H_ */
\ No newline at end of file
+
+#endif /* TWI_CFG_H_ */
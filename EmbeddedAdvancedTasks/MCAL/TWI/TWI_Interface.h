@@ -11,7 +11,28 @@ typedef enum{
 	SlaveAddressWithReadErr,
 	MasterWriteByteErr,
 	MasterReadByteErr,
+	ArbitrationLostErr,
+	BusErr,
+	BusTimeoutErr,
+	TransactionBusyErr,
+	TransactionParamErr,
 	}TWI_ErrStatus;
+
+/* Descriptor of one complete master transaction run by the TWI interrupt:
+ * START, SLA+W, TxLength bytes from TxBuffer (e.g. register address),
+ * then if RxLength!=0 : REPEATED START, SLA+R, RxLength bytes into RxBuffer
+ * (ACK on every byte except the last one which is NACKed), STOP.
+ * CallBack is called from the ISR with the final status of the transaction.
+ * At least one of TxLength/RxLength must be non zero and every buffer with a
+ * non zero length must be valid, otherwise TransactionParamErr is returned */
+typedef struct{
+	u8  SlaveAddress;
+	u8* TxBuffer;
+	u8  TxLength;
+	u8* RxBuffer;
+	u8  RxLength;
+	void(*CallBack)(TWI_ErrStatus);
+	}TWI_Transaction_type;
 /*******************************************************************************
  *                      Preprocessor Macros                                    *
  *******************************************************************************/
@@ -24,18 +45,35 @@ typedef enum{
 #define TWI_MT_DATA_ACK   0x28 /* Master transmit data and ACK has been received from Slave. */
 #define TWI_MR_DATA_ACK   0x50 /* Master received data and send ACK to slave. */
 #define TWI_MR_DATA_NACK  0x58 /* Master received data but doesn't send ACK to slave. */
+#define TWI_MT_SLA_W_NACK 0x20 /* Master transmit ( slave address + Write request ) to slave + NACK received from slave. */
+#define TWI_MT_DATA_NACK  0x30 /* Master transmit data and NACK has been received from Slave. */
+#define TWI_ARB_LOST      0x38 /* Arbitration lost in SLA+R/W or data bytes. */
+#define TWI_MR_SLA_R_NACK 0x48 /* Master transmit ( slave address + Read request ) to slave + NACK received from slave. */
+#define TWI_BUS_ERROR     0x00 /* Illegal start or stop condition on the bus. */
 
 /*******************************************************************************
  *                      Functions Prototypes                                   *
  *******************************************************************************/
 void TWI_voidMasterInit(u8 Copu_u8SlaveAddress);
 void TWI_voidSlaveInit(u8 Copu_u8SlaveAddress);
+u32 TWI_SetBitrate(u32 Copy_u32BitrateHz);
 TWI_ErrStatus TWI_SendStartCondition(void);
 TWI_ErrStatus TWI_SendRepeatedStart(void);
 TWI_ErrStatus TWI_SendSlaveAddressWithWrite(u8 Copy_u8SlaveAddress);
 TWI_ErrStatus TWI_SendSlaveAddressWithRead(u8 Copy_u8SlaveAddress);
 TWI_ErrStatus TWI_MasterWriteDataByte(u8 Copy_u8DataByte);
 TWI_ErrStatus TWI_MasterReadDataByte(u8*Copy_u8DataByte);
+TWI_ErrStatus TWI_MasterReadDataByteNack(u8*Copy_u8DataByte);
 void TWI_SendStopCondition(void);
 
+/*Multi byte transfers in one bus transaction (start ... stop)*/
+TWI_ErrStatus TWI_WriteBurst(u8 Copy_u8SlaveAddress,u8 Copy_u8Register,const u8*Copy_pu8Data,u16 Copy_u16Length);
+TWI_ErrStatus TWI_ReadBurst(u8 Copy_u8SlaveAddress,u8 Copy_u8Register,u8*Copy_pu8Data,u16 Copy_u16Length);
+
+/*Interrupt driven master*/
+TWI_ErrStatus TWI_StartTransaction(const TWI_Transaction_type*Copy_pTransaction);
+u8 TWI_IsBusy(void);
+void TWI_TimeoutTick(void);
+void TWI_BusRecovery(void);
+
 #endif /* TWI_INTERFACE_H_ */
\ No newline at end of file
@@ -9,8 +9,35 @@
 #ifndef TWI_PRIVATE_H_
 #define TWI_PRIVATE_H_
 
+/* Values written to TWCR by the interrupt driven master, every write clears TWINT
+ * so the hardware starts the next bus operation and keeps TWI + its interrupt enabled */
+#define TWI_CMD_START       ((1<<TWINT)|(1<<TWSTA)|(1<<TWEN)|(1<<TWIE))
+#define TWI_CMD_SEND        ((1<<TWINT)|(1<<TWEN)|(1<<TWIE))
+#define TWI_CMD_READ_ACK    ((1<<TWINT)|(1<<TWEA)|(1<<TWEN)|(1<<TWIE))
+#define TWI_CMD_READ_NACK   ((1<<TWINT)|(1<<TWEN)|(1<<TWIE))
+/* STOP and RELEASE leave TWIE cleared, the transaction is finished */
+#define TWI_CMD_STOP        ((1<<TWINT)|(1<<TWSTO)|(1<<TWEN))
+#define TWI_CMD_RELEASE     ((1<<TWINT)|(1<<TWEN))
 
+#define TWI_STATUS_MASK     0xF8
 
+/* Bit rate generator limits */
+#define TWI_MAX_TWBR           255
+#define TWI_PRESCALER_NUMBERS  4
+#define TWI_MAX_BITRATE        400000UL
 
+/* SCL/SDA are PC0/PC1 on ATmega32, used to clock a stuck slave free */
+#define TWI_SCL_PIN         0
+#define TWI_SDA_PIN         1
+#define TWI_RECOVERY_CLOCKS 9
 
-#endif /* TWI_PRIVATE_H_ */
\ No newline at end of file
+typedef enum{
+	TWI_IDLE,
+	TWI_BUSY
+	}TWI_State_type;
+
+static void TWI_FinishTransaction(TWI_ErrStatus Copy_ErrStatus);
+
+
+
+#endif /* TWI_PRIVATE_H_ */
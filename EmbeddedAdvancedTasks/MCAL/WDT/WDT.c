@@ -8,15 +8,27 @@
 
 void WDT_Set(TimeOut_t time)
 {
-	u8 WDT_Value=0x08;
-	WDT_Value|=time;
+	u8 sreg=SREG;
 	cli();
-	WDTCR|=(1<<WDE)|(1<<WDTOE);
-	WDTCR=WDT_Value;
-	sei();
+	/*reset the counter so the new time out can't fire at once*/
+	wdr();
+	/*timed sequence : WDE and WDTOE in one plain write (no read modify write)
+	 *then the new value within 4 cycles*/
+	WDTCR=(1<<WDE)|(1<<WDTOE);
+	WDTCR=(1<<WDE)|(time&WDT_PRESCALER_MASK);
+	/*the interrupts come back only if they were enabled*/
+	SREG=sreg;
 }
 void WDT_Stop(void)
 {
+	u8 sreg=SREG;
+	cli();
+	wdr();
 	WDTCR=(1<<WDE)|(1<<WDTOE);
 	WDTCR=0;
+	SREG=sreg;
+}
+void WDT_Reset(void)
+{
+	wdr();
 }
\ No newline at end of file
@@ -17,6 +17,8 @@ typedef enum{
 
 void WDT_Set(TimeOut_t time);
 void WDT_Stop(void);
+/*restarts the time out (wdr)*/
+void WDT_Reset(void);
 
 
 
@@ -3,6 +3,8 @@
 #ifndef WDT_PRIVATE_H_
 #define WDT_PRIVATE_H_
 
+#define WDT_PRESCALER_MASK   0x07
+
 
 
 
@@ -39,6 +39,11 @@
 
 #define ADC (*(volatile unsigned short*)0x24)
 
+/**********************Analog Comparator****************************/
+#define ACSR (*(volatile unsigned char*)0x28)
+#define ACIE 3
+#define ACI  4
+
 /************************************************************************************************/
 /* Timer 0 */
 #define TCNT0   (*(volatile unsigned char*)0x52)
@@ -89,11 +94,16 @@
 #define TCCR1A        (*(volatile unsigned char*)0x4F)
 
 #define SFIOR       (*(volatile unsigned char*)0x50)
+/* SFIOR */
+#define ADTS2   7
+#define ADTS1   6
+#define ADTS0   5
 
 #define OSCCAL       (*(volatile unsigned char*)0x51)
 /******************************************************************************/
 /* Timer 2 */
 
+#define ASSR     (*(volatile unsigned char*)0x42)
 #define OCR2     (*(volatile unsigned char*)0x43)
 #define TCNT2    (*(volatile unsigned char*)0x44)
 #define TCCR2    (*(volatile unsigned char*)0x45)
@@ -312,6 +322,12 @@
 /*External Interrupt */
 #define MCUCSR   (*(volatile unsigned char*)0x54)
 #define ISC2 6
+/* MCUCSR reset flags */
+#define JTRF  4
+#define WDRF  3
+#define BORF  2
+#define EXTRF 1
+#define PORF  0
 
 #define MCUCR   (*(volatile unsigned char*)0x55)
 #define ISC00 0
@@ -374,10 +390,12 @@
 #  define BAD_vect        __vector_default
 
 /*interrupt functions*/
+#define SREG    (*(volatile unsigned char*)0x5F)
 
 # define sei()  __asm__ __volatile__ ("sei" ::)
 # define cli()  __asm__ __volatile__ ("cli" ::)
 # define reti()  __asm__ __volatile__ ("reti" ::)
+# define wdr()  __asm__ __volatile__ ("wdr" ::)
 # define ret()  __asm__ __volatile__ ("ret" ::)
 
 #  define ISR_NOBLOCK    __attribute__((interrupt))
@@ -0,0 +1,111 @@
+/*
+ * AdcFilter.c
+ *
+ * Created: 10/18/2026 2:13:51 PM
+ *  Author: Demiana Younes
+ */ 
+
+#include "StdTypes.h"
+#include "MemMap.h"
+
+#include "AdcFilter_Interface.h"
+#include "AdcFilter_Config.h"
+#include "AdcFilter_Private.h"
+
+static const AdcFilter_Config_type AdcFilter_Config[ADCF_CHANNELS_NUMBER]=ADCF_CHANNELS_CONFIG;
+static AdcFilter_State_type AdcFilter_State[ADCF_CHANNELS_NUMBER];
+
+void AdcFilter_Init(void)
+{
+	u8 Local_u8Channel,Local_u8Iterator;
+	for(Local_u8Channel=0;Local_u8Channel<ADCF_CHANNELS_NUMBER;Local_u8Channel++)
+	{
+		AdcFilter_State[Local_u8Channel].Accumulator=0;
+		AdcFilter_State[Local_u8Channel].Count=0;
+		AdcFilter_State[Local_u8Channel].Oversampled=0;
+		AdcFilter_State[Local_u8Channel].WindowIndex=0;
+		AdcFilter_State[Local_u8Channel].WindowSum=0;
+		AdcFilter_State[Local_u8Channel].IIRState=0;
+		for(Local_u8Iterator=0;Local_u8Iterator<ADCF_MA_WINDOW;Local_u8Iterator++)
+		{
+			AdcFilter_State[Local_u8Channel].Window[Local_u8Iterator]=0;
+		}
+	}
+}
+
+/*runs in the ADC ISR (scan call back), the getters read its multi byte state with the interrupts off*/
+u8 AdcFilter_AddSample(u8 Copy_u8Channel,u16 Copy_u16Sample)
+{
+	u8 Local_u8Ready=0;
+	u8 Local_u8ExtraBits;
+	u16 Local_u16Value;
+	AdcFilter_State_type*Local_pState;
+	if(Copy_u8Channel<ADCF_CHANNELS_NUMBER)
+	{
+		Local_pState=&AdcFilter_State[Copy_u8Channel];
+		Local_u8ExtraBits=AdcFilter_Config[Copy_u8Channel].ExtraBits;
+		Local_pState->Accumulator+=Copy_u16Sample;
+		Local_pState->Count++;
+		/*4^n samples = 1<<(2n)*/
+		if(Local_pState->Count>=((u8)1<<(2*Local_u8ExtraBits)))
+		{
+			/*decimation : sum of 4^n samples shifted by n --> n more bits*/
+			Local_u16Value=(u16)(Local_pState->Accumulator>>Local_u8ExtraBits);
+			Local_pState->Oversampled=Local_u16Value;
+			Local_pState->Accumulator=0;
+			Local_pState->Count=0;
+			/*moving average : replace the oldest value in the running sum*/
+			Local_pState->WindowSum-=Local_pState->Window[Local_pState->WindowIndex];
+			Local_pState->WindowSum+=Local_u16Value;
+			Local_pState->Window[Local_pState->WindowIndex]=Local_u16Value;
+			Local_pState->WindowIndex=(Local_pState->WindowIndex+1)&(ADCF_MA_WINDOW-1);
+			/*IIR : S+=x-S/2^k , y=S/2^k  (S keeps the fraction bits of y)*/
+			Local_pState->IIRState-=Local_pState->IIRState>>AdcFilter_Config[Copy_u8Channel].IIRShift;
+			Local_pState->IIRState+=Local_u16Value;
+			Local_u8Ready=1;
+		}
+	}
+	return Local_u8Ready;
+}
+
+u16 AdcFilter_GetOversampled(u8 Copy_u8Channel)
+{
+	u16 Local_u16Value=0;
+	u8 Local_u8Sreg;
+	if(Copy_u8Channel<ADCF_CHANNELS_NUMBER)
+	{
+		Local_u8Sreg=SREG;
+		cli();
+		Local_u16Value=AdcFilter_State[Copy_u8Channel].Oversampled;
+		SREG=Local_u8Sreg;
+	}
+	return Local_u16Value;
+}
+
+u16 AdcFilter_GetMovingAverage(u8 Copy_u8Channel)
+{
+	u16 Local_u16Value=0;
+	u8 Local_u8Sreg;
+	if(Copy_u8Channel<ADCF_CHANNELS_NUMBER)
+	{
+		Local_u8Sreg=SREG;
+		cli();
+		Local_u16Value=(u16)(AdcFilter_State[Copy_u8Channel].WindowSum>>ADCF_MA_SHIFT);
+		SREG=Local_u8Sreg;
+	}
+	return Local_u16Value;
+}
+
+u16 AdcFilter_GetIIR(u8 Copy_u8Channel)
+{
+	u16 Local_u16Value=0;
+	u8 Local_u8Sreg;
+	if(Copy_u8Channel<ADCF_CHANNELS_NUMBER)
+	{
+		Local_u8Sreg=SREG;
+		cli();
+		Local_u16Value=(u16)(AdcFilter_State[Copy_u8Channel].IIRState>>AdcFilter_Config[Copy_u8Channel].IIRShift);
+		SREG=Local_u8Sreg;
+	}
+	return Local_u16Value;
+}
@@ -0,0 +1,32 @@
+/*
+ * AdcFilter_Config.h
+ *
+ * Created: 10/18/2026 2:14:27 PM
+ *  Author: Demiana Younes
+ */ 
+
+
+#ifndef ADCFILTER_CONFIG_H_
+#define ADCFILTER_CONFIG_H_
+
+/*number of filtered channels, the state of every channel is allocated at compile time*/
+#define ADCF_CHANNELS_NUMBER     2
+
+/*moving average window = 2^ADCF_MA_SHIFT decimated values*/
+#define ADCF_MA_SHIFT            3
+
+/*oversampling needs at least 1 LSB of noise on the input to gain resolution
+ *ExtraBits of every channel is checked at compile time (0:3)*/
+#define ADCF_CH0_EXTRA_BITS      2   /*MPX4115 pressure --> 12 bit, 16 samples per output*/
+#define ADCF_CH0_IIR_SHIFT       3
+#define ADCF_CH1_EXTRA_BITS      3   /*LM35 temperature --> 13 bit, 64 samples per output*/
+#define ADCF_CH1_IIR_SHIFT       2
+
+#define ADCF_CHANNELS_CONFIG  {\
+	{ADCF_CH0_EXTRA_BITS,ADCF_CH0_IIR_SHIFT},\
+	{ADCF_CH1_EXTRA_BITS,ADCF_CH1_IIR_SHIFT}\
+}
+
+
+
+#endif /* ADCFILTER_CONFIG_H_ */
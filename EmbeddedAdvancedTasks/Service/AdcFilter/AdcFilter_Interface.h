@@ -0,0 +1,49 @@
+/*
+ * AdcFilter_Interface.h
+ *
+ * Created: 10/18/2026 2:14:09 PM
+ *  Author: Demiana Younes
+ */ 
+
+
+#ifndef ADCFILTER_INTERFACE_H_
+#define ADCFILTER_INTERFACE_H_
+
+typedef struct{
+	u8 ExtraBits;   /*oversampling 4^ExtraBits samples --> 10+ExtraBits bits (0:3)*/
+	u8 IIRShift;    /*IIR y+=(x-y)/2^IIRShift, bigger is smoother and slower*/
+	}AdcFilter_Config_type;
+
+/**
+ * @brief Clears the accumulators and the filters state of all channels.
+ */
+void AdcFilter_Init(void);
+
+/**
+ * @brief Adds one raw 10 bit sample to a filter channel.
+ *
+ *        Every 4^ExtraBits samples the sum is decimated (shifted right by
+ *        ExtraBits) to a 10+ExtraBits bit result which is pushed in the moving
+ *        average and the IIR filter of the channel.
+ *        Call it from the ADC scan call back with the values of ADC_ScanGetBuffer.
+ *
+ * @return 1 when a new filtered output is ready, 0 otherwise.
+ */
+u8 AdcFilter_AddSample(u8 Copy_u8Channel,u16 Copy_u16Sample);
+
+/**
+ * @brief Last decimated value (10+ExtraBits bits).
+ */
+u16 AdcFilter_GetOversampled(u8 Copy_u8Channel);
+
+/**
+ * @brief Moving average of the last 2^ADCF_MA_SHIFT decimated values.
+ */
+u16 AdcFilter_GetMovingAverage(u8 Copy_u8Channel);
+
+/**
+ * @brief First order IIR (exponential) filter of the decimated values.
+ */
+u16 AdcFilter_GetIIR(u8 Copy_u8Channel);
+
+#endif /* ADCFILTER_INTERFACE_H_ */
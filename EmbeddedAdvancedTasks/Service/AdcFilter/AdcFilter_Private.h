@@ -0,0 +1,37 @@
+/*
+ * AdcFilter_Private.h
+ *
+ * Created: 10/18/2026 2:14:44 PM
+ *  Author: Demiana Younes
+ */ 
+
+
+#ifndef ADCFILTER_PRIVATE_H_
+#define ADCFILTER_PRIVATE_H_
+
+#define ADCF_MA_WINDOW        (1<<ADCF_MA_SHIFT)
+
+/*the u8 sample counter reaches 4^3=64, 4^4=256 never fits in it*/
+#define ADCF_MAX_EXTRA_BITS   3
+
+#if ADCF_CHANNELS_NUMBER>4
+#error "only the ExtraBits of channels 0:3 are checked, add the next channels below"
+#endif
+#if (ADCF_CH0_EXTRA_BITS>ADCF_MAX_EXTRA_BITS)||(ADCF_CH1_EXTRA_BITS>ADCF_MAX_EXTRA_BITS)||\
+    (ADCF_CH2_EXTRA_BITS>ADCF_MAX_EXTRA_BITS)||(ADCF_CH3_EXTRA_BITS>ADCF_MAX_EXTRA_BITS)
+#error "ADCF_CHx_EXTRA_BITS must be 0:3, the oversampled result would never be ready"
+#endif
+
+typedef struct{
+	u32 Accumulator;                  /*sum of the raw samples*/
+	u8  Count;                        /*raw samples in the accumulator*/
+	u16 Oversampled;                  /*last decimated value*/
+	u16 Window[ADCF_MA_WINDOW];       /*moving average history*/
+	u8  WindowIndex;
+	u32 WindowSum;
+	u32 IIRState;                     /*IIR output * 2^IIRShift*/
+	}AdcFilter_State_type;
+
+
+
+#endif /* ADCFILTER_PRIVATE_H_ */
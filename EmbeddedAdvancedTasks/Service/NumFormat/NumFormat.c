@@ -0,0 +1,190 @@
+/*
+ * NumFormat.c
+ *
+ * Created: 10/18/2026 7:12:18 PM
+ *  Author: Demiana Younes
+ */ 
+
+#include "StdTypes.h"
+
+#include "NumFormat_Interface.h"
+#include "NumFormat_Config.h"
+#include "NumFormat_Private.h"
+
+static u32 NumFormat_DivMod10(u32 Copy_u32Num,u8*Copy_pu8Rem)
+{
+	u32 Local_u32Quotient;
+	u8 Local_u8Rem;
+	/*Quotient ~= Num*0.8/8 , the error is at most 1 and corrected with the remainder*/
+	Local_u32Quotient=(Copy_u32Num>>1)+(Copy_u32Num>>2);
+	Local_u32Quotient+=Local_u32Quotient>>4;
+	Local_u32Quotient+=Local_u32Quotient>>8;
+	Local_u32Quotient+=Local_u32Quotient>>16;
+	Local_u32Quotient>>=3;
+	Local_u8Rem=(u8)(Copy_u32Num-((Local_u32Quotient<<3)+(Local_u32Quotient<<1)));
+	if(Local_u8Rem>9)
+	{
+		Local_u32Quotient++;
+		Local_u8Rem-=10;
+	}
+	*Copy_pu8Rem=Local_u8Rem;
+	return Local_u32Quotient;
+}
+
+static u16 NumFormat_DivMod10_16(u16 Copy_u16Num,u8*Copy_pu8Rem)
+{
+	u16 Local_u16Quotient;
+	u8 Local_u8Rem;
+	Local_u16Quotient=(Copy_u16Num>>1)+(Copy_u16Num>>2);
+	Local_u16Quotient+=Local_u16Quotient>>4;
+	Local_u16Quotient+=Local_u16Quotient>>8;
+	Local_u16Quotient>>=3;
+	Local_u8Rem=(u8)(Copy_u16Num-((Local_u16Quotient<<3)+(Local_u16Quotient<<1)));
+	if(Local_u8Rem>9)
+	{
+		Local_u16Quotient++;
+		Local_u8Rem-=10;
+	}
+	*Copy_pu8Rem=Local_u8Rem;
+	return Local_u16Quotient;
+}
+
+static void NumFormat_Reverse(u8*Copy_pu8Buffer,u8 Copy_u8Length)
+{
+	u8 Local_u8Start=0,Local_u8End=Copy_u8Length,Local_u8Temp;
+	Copy_pu8Buffer[Copy_u8Length]=0;
+	while(Local_u8End>Local_u8Start+1)
+	{
+		Local_u8End--;
+		Local_u8Temp=Copy_pu8Buffer[Local_u8Start];
+		Copy_pu8Buffer[Local_u8Start]=Copy_pu8Buffer[Local_u8End];
+		Copy_pu8Buffer[Local_u8End]=Local_u8Temp;
+		Local_u8Start++;
+	}
+}
+
+/*digits from the lowest one, the caller reverses them*/
+static u8 NumFormat_Digits(u32 Copy_u32Num,u8*Copy_pu8Buffer)
+{
+	u8 Local_u8Length=0,Local_u8Rem;
+	u16 Local_u16Num;
+	/*switch to the cheaper 16 bit division as soon as the number fits*/
+	while(Copy_u32Num>0xFFFF)
+	{
+		Copy_u32Num=NumFormat_DivMod10(Copy_u32Num,&Local_u8Rem);
+		Copy_pu8Buffer[Local_u8Length++]=Local_u8Rem+'0';
+	}
+	Local_u16Num=(u16)Copy_u32Num;
+	do
+	{
+		Local_u16Num=NumFormat_DivMod10_16(Local_u16Num,&Local_u8Rem);
+		Copy_pu8Buffer[Local_u8Length++]=Local_u8Rem+'0';
+	}while(Local_u16Num);
+	return Local_u8Length;
+}
+
+u8 NumFormat_U32(u32 Copy_u32Num,u8*Copy_pu8Buffer)
+{
+	u8 Local_u8Length=NumFormat_Digits(Copy_u32Num,Copy_pu8Buffer);
+	NumFormat_Reverse(Copy_pu8Buffer,Local_u8Length);
+	return Local_u8Length;
+}
+
+u8 NumFormat_U16(u16 Copy_u16Num,u8*Copy_pu8Buffer)
+{
+	return NumFormat_U32(Copy_u16Num,Copy_pu8Buffer);
+}
+
+u8 NumFormat_S32(s32 Copy_s32Num,u8*Copy_pu8Buffer)
+{
+	u8 Local_u8Length=0;
+	if(Copy_s32Num<0)
+	{
+		Copy_pu8Buffer[Local_u8Length++]='-';
+		/*through u32 so -2147483648 is not an overflow*/
+		Local_u8Length+=NumFormat_U32((u32)0-(u32)Copy_s32Num,Copy_pu8Buffer+1);
+	}
+	else
+	{
+		Local_u8Length+=NumFormat_U32((u32)Copy_s32Num,Copy_pu8Buffer);
+	}
+	return Local_u8Length;
+}
+
+u8 NumFormat_U32Digits(u32 Copy_u32Num,u8 Copy_u8Digits,u8*Copy_pu8Buffer)
+{
+	u8 Local_u8Iterator,Local_u8Rem;
+	for(Local_u8Iterator=0;Local_u8Iterator<Copy_u8Digits;Local_u8Iterator++)
+	{
+		Copy_u32Num=NumFormat_DivMod10(Copy_u32Num,&Local_u8Rem);
+		Copy_pu8Buffer[Local_u8Iterator]=Local_u8Rem+'0';
+	}
+	NumFormat_Reverse(Copy_pu8Buffer,Copy_u8Digits);
+	return Copy_u8Digits;
+}
+
+u8 NumFormat_Hex(u32 Copy_u32Num,u8 Copy_u8Digits,u8*Copy_pu8Buffer)
+{
+	u8 Local_u8Length=0,Local_u8Nibble;
+	do
+	{
+		Local_u8Nibble=(u8)Copy_u32Num&0x0F;
+		Copy_pu8Buffer[Local_u8Length++]=(Local_u8Nibble>9)?(Local_u8Nibble-10+NUMFORMAT_HEX_LETTER):(Local_u8Nibble+'0');
+		Copy_u32Num>>=4;
+	}while(((Copy_u8Digits==0)&&Copy_u32Num)||(Local_u8Length<Copy_u8Digits));
+	NumFormat_Reverse(Copy_pu8Buffer,Local_u8Length);
+	return Local_u8Length;
+}
+
+u8 NumFormat_Binary(u32 Copy_u32Num,u8 Copy_u8Bits,u8*Copy_pu8Buffer)
+{
+	u8 Local_u8Length=0;
+	do
+	{
+		Copy_pu8Buffer[Local_u8Length++]=((u8)Copy_u32Num&1)+'0';
+		Copy_u32Num>>=1;
+	}while(((Copy_u8Bits==0)&&Copy_u32Num)||(Local_u8Length<Copy_u8Bits));
+	NumFormat_Reverse(Copy_pu8Buffer,Local_u8Length);
+	return Local_u8Length;
+}
+
+u8 NumFormat_Q16(s32 Copy_s32Value,u8 Copy_u8Decimals,u8*Copy_pu8Buffer)
+{
+	u8 Local_u8Length=0,Local_u8Iterator;
+	u32 Local_u32Value,Local_u32Integer,Local_u32Fraction,Local_u32Power5=1;
+	if(Copy_u8Decimals>NUMFORMAT_MAX_DECIMALS)
+	{
+		Copy_u8Decimals=NUMFORMAT_MAX_DECIMALS;
+	}
+	if(Copy_s32Value<0)
+	{
+		Copy_pu8Buffer[Local_u8Length++]='-';
+		Local_u32Value=(u32)0-(u32)Copy_s32Value;
+	}
+	else
+	{
+		Local_u32Value=(u32)Copy_s32Value;
+	}
+	Local_u32Integer=Local_u32Value>>16;
+	/*fraction*10^d/2^16 = fraction*5^d/2^(16-d) , exact in 32 bit up to 5 decimals*/
+	Local_u32Fraction=Local_u32Value&NUMFORMAT_Q16_FRACTION;
+	for(Local_u8Iterator=0;Local_u8Iterator<Copy_u8Decimals;Local_u8Iterator++)
+	{
+		Local_u32Fraction=(Local_u32Fraction<<2)+Local_u32Fraction;
+		Local_u32Power5=(Local_u32Power5<<2)+Local_u32Power5;
+	}
+	Local_u32Fraction=(Local_u32Fraction+(1UL<<(15-Copy_u8Decimals)))>>(16-Copy_u8Decimals);
+	/*rounded up to 10^d : the carry goes to the integer part (0.999 --> "1.00")*/
+	if(Local_u32Fraction==(Local_u32Power5<<Copy_u8Decimals))
+	{
+		Local_u32Fraction=0;
+		Local_u32Integer++;
+	}
+	Local_u8Length+=NumFormat_U32(Local_u32Integer,Copy_pu8Buffer+Local_u8Length);
+	if(Copy_u8Decimals)
+	{
+		Copy_pu8Buffer[Local_u8Length++]='.';
+		Local_u8Length+=NumFormat_U32Digits(Local_u32Fraction,Copy_u8Decimals,Copy_pu8Buffer+Local_u8Length);
+	}
+	return Local_u8Length;
+}
\ No newline at end of file
@@ -0,0 +1,18 @@
+/*
+ * NumFormat_Config.h
+ *
+ * Created: 10/18/2026 7:13:02 PM
+ *  Author: Demiana Younes
+ */ 
+
+
+#ifndef NUMFORMAT_CONFIG_H_
+#define NUMFORMAT_CONFIG_H_
+
+/*hex digits : 'A' for upper case , 'a' for lower case*/
+#define NUMFORMAT_HEX_LETTER     'A'
+
+/*the fraction of Q16.16 has a resolution of 1/65536 so more than 5 decimals is noise*/
+#define NUMFORMAT_MAX_DECIMALS   5
+
+#endif /* NUMFORMAT_CONFIG_H_ */
\ No newline at end of file
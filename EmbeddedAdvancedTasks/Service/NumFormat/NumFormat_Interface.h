@@ -0,0 +1,66 @@
+/*
+ * NumFormat_Interface.h
+ *
+ * Created: 10/18/2026 7:12:40 PM
+ *  Author: Demiana Younes
+ */ 
+
+
+#ifndef NUMFORMAT_INTERFACE_H_
+#define NUMFORMAT_INTERFACE_H_
+
+/*buffer sizes including the terminating 0*/
+#define NUMFORMAT_U32_SIZE      11
+#define NUMFORMAT_S32_SIZE      12
+#define NUMFORMAT_HEX_SIZE      9
+#define NUMFORMAT_BIN_SIZE      33
+#define NUMFORMAT_Q16_SIZE      13      /*"-32768.00000"*/
+
+/**
+ * @brief Unsigned decimal without leading zeros ("0" for 0).
+ *
+ *        No division is used : every digit is taken with a shift and add
+ *        multiply by 1/10, much faster than the library %10 and /10 on AVR.
+ *
+ * @param Copy_pu8Buffer at least NUMFORMAT_U32_SIZE bytes, 0 terminated.
+ * @return number of characters written (without the 0).
+ */
+u8 NumFormat_U32(u32 Copy_u32Num,u8*Copy_pu8Buffer);
+
+/**
+ * @brief Same as NumFormat_U32 with 16 bit arithmetic (6 bytes are enough).
+ */
+u8 NumFormat_U16(u16 Copy_u16Num,u8*Copy_pu8Buffer);
+
+/**
+ * @brief Signed decimal with a leading '-' for negative numbers.
+ */
+u8 NumFormat_S32(s32 Copy_s32Num,u8*Copy_pu8Buffer);
+
+/**
+ * @brief The last Copy_u8Digits decimal digits with leading zeros
+ *        (ex: 4 digits of 123 --> "0123", of 12345 --> "2345").
+ *
+ * @param Copy_pu8Buffer at least Copy_u8Digits+1 bytes.
+ */
+u8 NumFormat_U32Digits(u32 Copy_u32Num,u8 Copy_u8Digits,u8*Copy_pu8Buffer);
+
+/**
+ * @brief Hexadecimal without prefix, Copy_u8Digits digits with leading zeros
+ *        or 0 for the minimum number of digits.
+ */
+u8 NumFormat_Hex(u32 Copy_u32Num,u8 Copy_u8Digits,u8*Copy_pu8Buffer);
+
+/**
+ * @brief Binary, Copy_u8Bits bits with leading zeros or 0 for the minimum
+ *        number of bits.
+ */
+u8 NumFormat_Binary(u32 Copy_u32Num,u8 Copy_u8Bits,u8*Copy_pu8Buffer);
+
+/**
+ * @brief Signed Q16.16 fixed point value (value/65536) rounded to
+ *        Copy_u8Decimals decimals (0:NUMFORMAT_MAX_DECIMALS), ex: 0x00018000 --> "1.50".
+ */
+u8 NumFormat_Q16(s32 Copy_s32Value,u8 Copy_u8Decimals,u8*Copy_pu8Buffer);
+
+#endif /* NUMFORMAT_INTERFACE_H_ */
\ No newline at end of file
@@ -0,0 +1,36 @@
+/*
+ * NumFormat_Private.h
+ *
+ * Created: 10/18/2026 7:13:21 PM
+ *  Author: Demiana Younes
+ */ 
+
+
+#ifndef NUMFORMAT_PRIVATE_H_
+#define NUMFORMAT_PRIVATE_H_
+
+#define NUMFORMAT_Q16_FRACTION   0xFFFFUL
+
+/**
+ * @brief Copy_u32Num/10 and Copy_u32Num%10 with shifts and adds only
+ *        (Hacker's Delight divu10).
+ */
+static u32 NumFormat_DivMod10(u32 Copy_u32Num,u8*Copy_pu8Rem);
+
+/**
+ * @brief 16 bit version of NumFormat_DivMod10.
+ */
+static u16 NumFormat_DivMod10_16(u16 Copy_u16Num,u8*Copy_pu8Rem);
+
+/**
+ * @brief Writes the decimal digits starting with the lowest one (at least "0").
+ *        The u32 division is only used while the number is over 0xFFFF.
+ */
+static u8 NumFormat_Digits(u32 Copy_u32Num,u8*Copy_pu8Buffer);
+
+/**
+ * @brief Reverses the Copy_u8Length first characters and adds the 0.
+ */
+static void NumFormat_Reverse(u8*Copy_pu8Buffer,u8 Copy_u8Length);
+
+#endif /* NUMFORMAT_PRIVATE_H_ */
\ No newline at end of file
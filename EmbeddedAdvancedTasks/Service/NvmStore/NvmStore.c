@@ -0,0 +1,248 @@
+/*
+ * NvmStore.c
+ *
+ * Created: 10/18/2026 11:01:52 AM
+ *  Author: Demiana Younes
+ */
+
+#include "StdTypes.h"
+#include "MemMap.h"
+
+#include "EEPROM_Interface.h"
+
+#include "NvmStore_Interface.h"
+#include "NvmStore_Config.h"
+#include "NvmStore_Private.h"
+
+/*RAM cache of the values, the application only works with it*/
+static volatile u16 NvmStore_Values[NVM_KEYS_NUMBER];
+static volatile u8  NvmStore_Dirty[NVM_KEYS_NUMBER];
+/*record index holding the latest copy of every key in EEPROM (NVM_NO_RECORD if none)*/
+static u8 NvmStore_Location[NVM_KEYS_NUMBER];
+
+/*ring state : last written record and the next sequence number*/
+static u8 NvmStore_Head=NVM_RECORDS_NUMBER-1;
+static u8 NvmStore_Sequence=0;
+
+/*record being written by the EE_RDY interrupt*/
+static u8 NvmStore_Buffer[NVM_RECORD_SIZE];
+static u8 NvmStore_Target;
+static u8 NvmStore_ByteIndex;
+static volatile u8 NvmStore_Busy=NVM_IDLE;
+
+/**
+ * @brief Rebuilds the cache from the EEPROM.
+ *
+ *        The records are written one after the other in a ring with an
+ *        increasing 8 bit sequence, so the newest record is the last valid one
+ *        that is not followed by its sequence+1. Walking back from it, the first
+ *        record found for a key is its latest value.
+ */
+void NvmStore_Init(void)
+{
+	u8 Local_u8Record,Local_u8Next,Local_u8Key,Local_u8Counter;
+	u8 Local_u8Found=0;
+	u8 Local_au8Record[NVM_RECORD_SIZE],Local_au8NextRecord[NVM_RECORD_SIZE];
+
+	for(Local_u8Key=0;Local_u8Key<NVM_KEYS_NUMBER;Local_u8Key++)
+	{
+		NvmStore_Location[Local_u8Key]=NVM_NO_RECORD;
+		NvmStore_Dirty[Local_u8Key]=0;
+		NvmStore_Values[Local_u8Key]=0xFFFF;
+	}
+	/*find the newest record*/
+	for(Local_u8Record=0;(Local_u8Record<NVM_RECORDS_NUMBER)&&(Local_u8Found==0);Local_u8Record++)
+	{
+		if(NvmStore_ReadRecord(Local_u8Record,Local_au8Record))
+		{
+			Local_u8Next=(Local_u8Record+1)%NVM_RECORDS_NUMBER;
+			if((NvmStore_ReadRecord(Local_u8Next,Local_au8NextRecord)==0)||
+			   (Local_au8NextRecord[NVM_RECORD_SEQ]!=(u8)(Local_au8Record[NVM_RECORD_SEQ]+1)))
+			{
+				NvmStore_Head=Local_u8Record;
+				NvmStore_Sequence=Local_au8Record[NVM_RECORD_SEQ]+1;
+				Local_u8Found=1;
+			}
+		}
+	}
+	/*newest to oldest*/
+	if(Local_u8Found)
+	{
+		Local_u8Record=NvmStore_Head;
+		for(Local_u8Counter=0;Local_u8Counter<NVM_RECORDS_NUMBER;Local_u8Counter++)
+		{
+			if(NvmStore_ReadRecord(Local_u8Record,Local_au8Record))
+			{
+				Local_u8Key=Local_au8Record[NVM_RECORD_KEY];
+				if(NvmStore_Location[Local_u8Key]==NVM_NO_RECORD)
+				{
+					NvmStore_Location[Local_u8Key]=Local_u8Record;
+					NvmStore_Values[Local_u8Key]=((u16)Local_au8Record[NVM_RECORD_HIGH]<<8)|Local_au8Record[NVM_RECORD_LOW];
+				}
+			}
+			Local_u8Record=(Local_u8Record==0)?(NVM_RECORDS_NUMBER-1):(Local_u8Record-1);
+		}
+	}
+	EEPROM_SetCallBack(NvmStore_EEReadyCallBack);
+}
+
+Error_t NvmStore_Read(u8 Copy_u8Key,u16*Copy_pu16Value)
+{
+	Error_t Local_Status=OK;
+	u8 Local_u8Sreg;
+	if(Copy_u8Key>=NVM_KEYS_NUMBER)
+	{
+		Local_Status=OUTOFRANGE;
+	}
+	else if((NvmStore_Location[Copy_u8Key]==NVM_NO_RECORD)&&(NvmStore_Dirty[Copy_u8Key]==0))
+	{
+		Local_Status=NOK;
+	}
+	else
+	{
+		Local_u8Sreg=SREG;
+		cli();
+		*Copy_pu16Value=NvmStore_Values[Copy_u8Key];
+		SREG=Local_u8Sreg;
+	}
+	return Local_Status;
+}
+
+Error_t NvmStore_Write(u8 Copy_u8Key,u16 Copy_u16Value)
+{
+	Error_t Local_Status=OK;
+	u8 Local_u8Sreg;
+	if(Copy_u8Key>=NVM_KEYS_NUMBER)
+	{
+		Local_Status=OUTOFRANGE;
+	}
+	else
+	{
+		Local_u8Sreg=SREG;
+		cli();
+		/*skip the write if the value is already stored or already waiting*/
+		if((NvmStore_Values[Copy_u8Key]!=Copy_u16Value)||
+		   ((NvmStore_Location[Copy_u8Key]==NVM_NO_RECORD)&&(NvmStore_Dirty[Copy_u8Key]==0)))
+		{
+			NvmStore_Values[Copy_u8Key]=Copy_u16Value;
+			NvmStore_Dirty[Copy_u8Key]=1;
+			if(NvmStore_Busy==NVM_IDLE)
+			{
+				/*EE_RDY fires as soon as it is enabled if no write is running*/
+				NvmStore_Busy=NVM_STARTING;
+				NvmStore_ByteIndex=NVM_RECORD_SIZE;
+				EEPROM_EnableInterrupt();
+			}
+		}
+		SREG=Local_u8Sreg;
+	}
+	return Local_Status;
+}
+
+u8 NvmStore_IsBusy(void)
+{
+	return (NvmStore_Busy!=NVM_IDLE);
+}
+
+static u8 NvmStore_ReadRecord(u8 Copy_u8Record,u8*Copy_pu8Buffer)
+{
+	u8 Local_u8Iterator;
+	u16 Local_u16Address=NVM_START_ADDRESS+((u16)Copy_u8Record*NVM_RECORD_SIZE);
+	for(Local_u8Iterator=0;Local_u8Iterator<NVM_RECORD_SIZE;Local_u8Iterator++)
+	{
+		Copy_pu8Buffer[Local_u8Iterator]=EEPROM_read(Local_u16Address+Local_u8Iterator);
+	}
+	/*erased (0xFF) and half written records are rejected by the check byte*/
+	return ((Copy_pu8Buffer[NVM_RECORD_KEY]<NVM_KEYS_NUMBER)&&
+	        (Copy_pu8Buffer[NVM_RECORD_CHECK]==NvmStore_Check(Copy_pu8Buffer)));
+}
+
+static u8 NvmStore_Check(const u8*Copy_pu8Buffer)
+{
+	return Copy_pu8Buffer[NVM_RECORD_KEY]^Copy_pu8Buffer[NVM_RECORD_SEQ]^
+	       Copy_pu8Buffer[NVM_RECORD_LOW]^Copy_pu8Buffer[NVM_RECORD_HIGH]^NVM_CHECK_SEED;
+}
+
+/**
+ * @brief Chooses the next record to write at the slot after the head.
+ *
+ *        The slot after the head never holds the latest copy of a key, so it
+ *        can be overwritten without risk. To keep it that way, if the slot after
+ *        the target holds the latest copy of a key, that key is written (with its
+ *        cached value) into the target first. The key then has a new copy before
+ *        its old slot is reused, a power loss in the middle of any write only
+ *        loses the record being written, and every slot gets the same number of
+ *        writes as old keys move forward with the ring.
+ *
+ * @return 1 if a record is ready in NvmStore_Buffer, 0 if nothing is dirty.
+ */
+static u8 NvmStore_PrepareRecord(void)
+{
+	u8 Local_u8Key,Local_u8Next,Local_u8Selected=NVM_NO_RECORD;
+	for(Local_u8Key=0;(Local_u8Key<NVM_KEYS_NUMBER)&&(Local_u8Selected==NVM_NO_RECORD);Local_u8Key++)
+	{
+		if(NvmStore_Dirty[Local_u8Key])
+		{
+			Local_u8Selected=Local_u8Key;
+		}
+	}
+	if(Local_u8Selected!=NVM_NO_RECORD)
+	{
+		NvmStore_Target=(NvmStore_Head+1)%NVM_RECORDS_NUMBER;
+		Local_u8Next=(NvmStore_Target+1)%NVM_RECORDS_NUMBER;
+		for(Local_u8Key=0;Local_u8Key<NVM_KEYS_NUMBER;Local_u8Key++)
+		{
+			if(NvmStore_Location[Local_u8Key]==Local_u8Next)
+			{
+				Local_u8Selected=Local_u8Key;
+				break;
+			}
+		}
+		NvmStore_Dirty[Local_u8Selected]=0;
+		NvmStore_Buffer[NVM_RECORD_KEY]=Local_u8Selected;
+		NvmStore_Buffer[NVM_RECORD_SEQ]=NvmStore_Sequence;
+		NvmStore_Buffer[NVM_RECORD_LOW]=(u8)NvmStore_Values[Local_u8Selected];
+		NvmStore_Buffer[NVM_RECORD_HIGH]=(u8)(NvmStore_Values[Local_u8Selected]>>8);
+		NvmStore_Buffer[NVM_RECORD_CHECK]=NvmStore_Check(NvmStore_Buffer);
+		NvmStore_ByteIndex=0;
+		return 1;
+	}
+	return 0;
+}
+
+/**
+ * @brief EE_RDY call back, writes one changed byte of the current record per
+ *        interrupt. Bytes already holding the right value are skipped.
+ */
+static void NvmStore_EEReadyCallBack(void)
+{
+	u16 Local_u16Address;
+	while(1)
+	{
+		if(NvmStore_ByteIndex>=NVM_RECORD_SIZE)
+		{
+			/*the previous record is complete (NvmStore_ByteIndex is also set to the end on start)*/
+			if(NvmStore_Busy==NVM_WRITING)
+			{
+				NvmStore_Head=NvmStore_Target;
+				NvmStore_Location[NvmStore_Buffer[NVM_RECORD_KEY]]=NvmStore_Target;
+				NvmStore_Sequence++;
+			}
+			if(NvmStore_PrepareRecord()==0)
+			{
+				EEPROM_DisableInterrupt();
+				NvmStore_Busy=NVM_IDLE;
+				return;
+			}
+			NvmStore_Busy=NVM_WRITING;
+		}
+		Local_u16Address=NVM_START_ADDRESS+((u16)NvmStore_Target*NVM_RECORD_SIZE)+NvmStore_ByteIndex;
+		if(EEPROM_read(Local_u16Address)!=NvmStore_Buffer[NvmStore_ByteIndex])
+		{
+			EEPROM_WriteDataInterrupt(Local_u16Address,NvmStore_Buffer[NvmStore_ByteIndex]);
+			NvmStore_ByteIndex++;
+			return;
+		}
+		NvmStore_ByteIndex++;
+	}
+}
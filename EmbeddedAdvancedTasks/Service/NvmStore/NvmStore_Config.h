@@ -0,0 +1,22 @@
+/*
+ * NvmStore_Config.h
+ *
+ * Created: 10/18/2026 11:02:31 AM
+ *  Author: Demiana Younes
+ */ 
+
+
+#ifndef NVMSTORE_CONFIG_H_
+#define NVMSTORE_CONFIG_H_
+
+/*number of keys, every key holds a u16 value (ex: high score, traffic timings)*/
+#define NVM_KEYS_NUMBER        8
+
+/*EEPROM area used as a ring of records, every record is 5 bytes
+ *204 records * 5 = 1020 bytes of the 1KB EEPROM, the writes are spread on all of them*/
+#define NVM_START_ADDRESS      0
+#define NVM_RECORDS_NUMBER     204
+
+
+
+#endif /* NVMSTORE_CONFIG_H_ */
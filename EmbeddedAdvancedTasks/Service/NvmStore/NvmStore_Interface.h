@@ -0,0 +1,40 @@
+/*
+ * NvmStore_Interface.h
+ *
+ * Created: 10/18/2026 11:02:14 AM
+ *  Author: Demiana Younes
+ */ 
+
+
+#ifndef NVMSTORE_INTERFACE_H_
+#define NVMSTORE_INTERFACE_H_
+
+/**
+ * @brief Scans the record area of the internal EEPROM, loads the latest value
+ *        of every key in the RAM cache and hooks the EE_RDY interrupt.
+ *        Must be called before the global interrupt is enabled.
+ */
+void NvmStore_Init(void);
+
+/**
+ * @brief Reads a value from the RAM cache, never touches the EEPROM.
+ *
+ * @return OK, NOK if the key was never written or OUTOFRANGE for a wrong key.
+ */
+Error_t NvmStore_Read(u8 Copy_u8Key,u16*Copy_pu16Value);
+
+/**
+ * @brief Updates the RAM cache and schedules the record to be written in the
+ *        background by the EE_RDY interrupt. Writing the value already stored
+ *        costs nothing.
+ *
+ * @return OK or OUTOFRANGE for a wrong key.
+ */
+Error_t NvmStore_Write(u8 Copy_u8Key,u16 Copy_u16Value);
+
+/**
+ * @brief Returns 1 while cached values are still being written to the EEPROM.
+ */
+u8 NvmStore_IsBusy(void);
+
+#endif /* NVMSTORE_INTERFACE_H_ */
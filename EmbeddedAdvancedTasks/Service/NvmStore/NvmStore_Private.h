@@ -0,0 +1,45 @@
+/*
+ * NvmStore_Private.h
+ *
+ * Created: 10/18/2026 11:02:47 AM
+ *  Author: Demiana Younes
+ */ 
+
+
+#ifndef NVMSTORE_PRIVATE_H_
+#define NVMSTORE_PRIVATE_H_
+
+/*Record layout in EEPROM : key , sequence , value low , value high , check*/
+#define NVM_RECORD_KEY         0
+#define NVM_RECORD_SEQ         1
+#define NVM_RECORD_LOW         2
+#define NVM_RECORD_HIGH        3
+#define NVM_RECORD_CHECK       4
+#define NVM_RECORD_SIZE        5
+
+#define NVM_CHECK_SEED         0xA5
+#define NVM_NO_RECORD          0xFF
+
+/*background writer states*/
+#define NVM_IDLE               0
+#define NVM_STARTING           1
+#define NVM_WRITING            2
+
+#if NVM_RECORDS_NUMBER>=255
+#error "NVM_RECORDS_NUMBER must be less than 255 (8 bit sequence and record index)"
+#endif
+#if NVM_RECORDS_NUMBER<=NVM_KEYS_NUMBER
+#error "NVM_RECORDS_NUMBER must be more than NVM_KEYS_NUMBER"
+#endif
+#if (NVM_START_ADDRESS+(NVM_RECORDS_NUMBER*NVM_RECORD_SIZE))>1024
+#error "NvmStore area is outside the 1KB EEPROM"
+#endif
+
+static u8 NvmStore_ReadRecord(u8 Copy_u8Record,u8*Copy_pu8Buffer);
+static u8 NvmStore_Check(const u8*Copy_pu8Buffer);
+static u8 NvmStore_PrepareRecord(void);
+static void NvmStore_EEReadyCallBack(void);
+
+
+
+#endif /* NVMSTORE_PRIVATE_H_ */
@@ -0,0 +1,248 @@
+/*
+ * SoftTimer.c
+ *
+ * Created: 10/18/2026 5:21:19 PM
+ *  Author: Demiana Younes
+ */ 
+
+#include "StdTypes.h"
+#include "MemMap.h"
+
+#include "Timer_Interface.h"
+
+#include "SoftTimer_Interface.h"
+#include "SoftTimer_Config.h"
+#include "SoftTimer_Private.h"
+
+/*timers pool*/
+static void (*SoftTimer_CallBacks[SOFTTIMER_MAX_TIMERS])(void);
+static u8  SoftTimer_Modes[SOFTTIMER_MAX_TIMERS];
+static volatile u8 SoftTimer_States[SOFTTIMER_MAX_TIMERS];
+static u16 SoftTimer_Periods[SOFTTIMER_MAX_TIMERS];
+/*full turns of the wheel left before the timer expires in its slot*/
+static u16 SoftTimer_Rounds[SOFTTIMER_MAX_TIMERS];
+
+/*hashed wheel : every slot is a double linked list of timers*/
+static u8 SoftTimer_Wheel[SOFTTIMER_WHEEL_SIZE];
+static u8 SoftTimer_Next[SOFTTIMER_MAX_TIMERS];
+static u8 SoftTimer_Prev[SOFTTIMER_MAX_TIMERS];
+static u8 SoftTimer_Slots[SOFTTIMER_MAX_TIMERS];
+static volatile u8 SoftTimer_Current=0;
+
+/*expired timers waiting for SoftTimer_Dispatch, one entry per timer at most*/
+static u8 SoftTimer_Ready[SOFTTIMER_MAX_TIMERS+1];
+static volatile u8 SoftTimer_ReadyHead=0;
+static volatile u8 SoftTimer_ReadyTail=0;
+static volatile u8 SoftTimer_Pending[SOFTTIMER_MAX_TIMERS];
+
+void SoftTimer_Init(void)
+{
+	u8 Local_u8Iterator,Local_u8Sreg;
+	for(Local_u8Iterator=0;Local_u8Iterator<SOFTTIMER_WHEEL_SIZE;Local_u8Iterator++)
+	{
+		SoftTimer_Wheel[Local_u8Iterator]=SOFTTIMER_NONE;
+	}
+	for(Local_u8Iterator=0;Local_u8Iterator<SOFTTIMER_MAX_TIMERS;Local_u8Iterator++)
+	{
+		SoftTimer_States[Local_u8Iterator]=SOFTTIMER_FREE;
+		SoftTimer_Pending[Local_u8Iterator]=SOFTTIMER_NOT_QUEUED;
+	}
+	/*rolling compare : Timer1 is not reset, OCR1A moves one tick ahead on every match*/
+	Timer1_OCA_SetCallBack(SoftTimer_TickCallBack);
+	Local_u8Sreg=SREG;
+	cli();
+	OCR1A=TCNT1+SOFTTIMER_TICK_COUNTS;
+	SREG=Local_u8Sreg;
+	Timer1_OCA_InterruptEnable();
+}
+
+Error_t SoftTimer_Create(u8*Copy_pu8Id,void(*Copy_pfCallBack)(void),SoftTimer_Mode_type Copy_Mode)
+{
+	u8 Local_u8Id;
+	Error_t Local_Status=NOK;
+	if((Copy_pu8Id==NULLPTR)||(Copy_pfCallBack==NULLPTR))
+	{
+		Local_Status=NOK;
+	}
+	else
+	{
+		for(Local_u8Id=0;Local_u8Id<SOFTTIMER_MAX_TIMERS;Local_u8Id++)
+		{
+			if(SoftTimer_States[Local_u8Id]==SOFTTIMER_FREE)
+			{
+				SoftTimer_CallBacks[Local_u8Id]=Copy_pfCallBack;
+				SoftTimer_Modes[Local_u8Id]=Copy_Mode;
+				SoftTimer_States[Local_u8Id]=SOFTTIMER_STOPPED;
+				*Copy_pu8Id=Local_u8Id;
+				Local_Status=OK;
+				break;
+			}
+		}
+	}
+	return Local_Status;
+}
+
+Error_t SoftTimer_Start(u8 Copy_u8Id,u16 Copy_u16PeriodMs)
+{
+	Error_t Local_Status=OK;
+	u8 Local_u8Sreg;
+	if((Copy_u8Id>=SOFTTIMER_MAX_TIMERS)||(SoftTimer_States[Copy_u8Id]==SOFTTIMER_FREE))
+	{
+		Local_Status=OUTOFRANGE;
+	}
+	else
+	{
+		if(Copy_u16PeriodMs==0)
+		{
+			Copy_u16PeriodMs=1;
+		}
+		Local_u8Sreg=SREG;
+		cli();
+		if(SoftTimer_States[Copy_u8Id]==SOFTTIMER_RUNNING)
+		{
+			SoftTimer_Remove(Copy_u8Id);
+		}
+		SoftTimer_Periods[Copy_u8Id]=Copy_u16PeriodMs;
+		SoftTimer_CancelPending(Copy_u8Id);
+		SoftTimer_Insert(Copy_u8Id,Copy_u16PeriodMs);
+		SoftTimer_States[Copy_u8Id]=SOFTTIMER_RUNNING;
+		SREG=Local_u8Sreg;
+	}
+	return Local_Status;
+}
+
+Error_t SoftTimer_Stop(u8 Copy_u8Id)
+{
+	Error_t Local_Status=OK;
+	u8 Local_u8Sreg;
+	if((Copy_u8Id>=SOFTTIMER_MAX_TIMERS)||(SoftTimer_States[Copy_u8Id]==SOFTTIMER_FREE))
+	{
+		Local_Status=OUTOFRANGE;
+	}
+	else
+	{
+		Local_u8Sreg=SREG;
+		cli();
+		if(SoftTimer_States[Copy_u8Id]==SOFTTIMER_RUNNING)
+		{
+			SoftTimer_Remove(Copy_u8Id);
+		}
+		SoftTimer_CancelPending(Copy_u8Id);
+		SoftTimer_States[Copy_u8Id]=SOFTTIMER_STOPPED;
+		SREG=Local_u8Sreg;
+	}
+	return Local_Status;
+}
+
+u8 SoftTimer_IsRunning(u8 Copy_u8Id)
+{
+	return (Copy_u8Id<SOFTTIMER_MAX_TIMERS)&&(SoftTimer_States[Copy_u8Id]==SOFTTIMER_RUNNING);
+}
+
+void SoftTimer_Dispatch(void)
+{
+	u8 Local_u8Id,Local_u8Pending,Local_u8Sreg;
+	while(SoftTimer_ReadyTail!=SoftTimer_ReadyHead)
+	{
+		Local_u8Sreg=SREG;
+		cli();
+		Local_u8Id=SoftTimer_Ready[SoftTimer_ReadyTail];
+		SoftTimer_ReadyTail=(SoftTimer_ReadyTail+1)%(SOFTTIMER_MAX_TIMERS+1);
+		Local_u8Pending=SoftTimer_Pending[Local_u8Id];
+		SoftTimer_Pending[Local_u8Id]=SOFTTIMER_NOT_QUEUED;
+		SREG=Local_u8Sreg;
+		if(Local_u8Pending==SOFTTIMER_QUEUED)
+		{
+			SoftTimer_CallBacks[Local_u8Id]();
+		}
+	}
+}
+
+/**
+ * @brief Puts a timer in the slot where it expires, interrupts must be off.
+ *
+ *        The slot is visited every SOFTTIMER_WHEEL_SIZE ticks, the first visit
+ *        is after ((delay-1)&mask)+1 ticks so the timer waits (delay-1)>>shift
+ *        more visits before it expires.
+ */
+static void SoftTimer_Insert(u8 Copy_u8Id,u16 Copy_u16Delay)
+{
+	u8 Local_u8Slot=(SoftTimer_Current+Copy_u16Delay)&SOFTTIMER_WHEEL_MASK;
+	SoftTimer_Rounds[Copy_u8Id]=(Copy_u16Delay-1)>>SOFTTIMER_WHEEL_SHIFT;
+	SoftTimer_Slots[Copy_u8Id]=Local_u8Slot;
+	SoftTimer_Prev[Copy_u8Id]=SOFTTIMER_NONE;
+	SoftTimer_Next[Copy_u8Id]=SoftTimer_Wheel[Local_u8Slot];
+	if(SoftTimer_Wheel[Local_u8Slot]!=SOFTTIMER_NONE)
+	{
+		SoftTimer_Prev[SoftTimer_Wheel[Local_u8Slot]]=Copy_u8Id;
+	}
+	SoftTimer_Wheel[Local_u8Slot]=Copy_u8Id;
+}
+
+static void SoftTimer_Remove(u8 Copy_u8Id)
+{
+	if(SoftTimer_Prev[Copy_u8Id]!=SOFTTIMER_NONE)
+	{
+		SoftTimer_Next[SoftTimer_Prev[Copy_u8Id]]=SoftTimer_Next[Copy_u8Id];
+	}
+	else
+	{
+		SoftTimer_Wheel[SoftTimer_Slots[Copy_u8Id]]=SoftTimer_Next[Copy_u8Id];
+	}
+	if(SoftTimer_Next[Copy_u8Id]!=SOFTTIMER_NONE)
+	{
+		SoftTimer_Prev[SoftTimer_Next[Copy_u8Id]]=SoftTimer_Prev[Copy_u8Id];
+	}
+}
+
+static void SoftTimer_SetPending(u8 Copy_u8Id)
+{
+	if(SoftTimer_Pending[Copy_u8Id]==SOFTTIMER_NOT_QUEUED)
+	{
+		/*the queue holds every timer once at most so it never overflows*/
+		SoftTimer_Ready[SoftTimer_ReadyHead]=Copy_u8Id;
+		SoftTimer_ReadyHead=(SoftTimer_ReadyHead+1)%(SOFTTIMER_MAX_TIMERS+1);
+	}
+	SoftTimer_Pending[Copy_u8Id]=SOFTTIMER_QUEUED;
+}
+
+/*a cancelled entry stays in the ready queue and is skipped by the dispatcher*/
+static void SoftTimer_CancelPending(u8 Copy_u8Id)
+{
+	if(SoftTimer_Pending[Copy_u8Id]==SOFTTIMER_QUEUED)
+	{
+		SoftTimer_Pending[Copy_u8Id]=SOFTTIMER_CANCELLED;
+	}
+}
+
+/*Timer1 compare A : one tick, only the timers of the current slot are checked*/
+static void SoftTimer_TickCallBack(void)
+{
+	u8 Local_u8Id,Local_u8Next;
+	OCR1A+=SOFTTIMER_TICK_COUNTS;
+	SoftTimer_Current=(SoftTimer_Current+1)&SOFTTIMER_WHEEL_MASK;
+	Local_u8Id=SoftTimer_Wheel[SoftTimer_Current];
+	while(Local_u8Id!=SOFTTIMER_NONE)
+	{
+		Local_u8Next=SoftTimer_Next[Local_u8Id];
+		if(SoftTimer_Rounds[Local_u8Id]==0)
+		{
+			SoftTimer_Remove(Local_u8Id);
+			if(SoftTimer_Modes[Local_u8Id]==SOFTTIMER_PERIODIC)
+			{
+				/*inserted at the head, not visited again in this tick*/
+				SoftTimer_Insert(Local_u8Id,SoftTimer_Periods[Local_u8Id]);
+			}
+			else
+			{
+				SoftTimer_States[Local_u8Id]=SOFTTIMER_STOPPED;
+			}
+			SoftTimer_SetPending(Local_u8Id);
+		}
+		else
+		{
+			SoftTimer_Rounds[Local_u8Id]--;
+		}
+		Local_u8Id=Local_u8Next;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,23 @@
+/*
+ * SoftTimer_Config.h
+ *
+ * Created: 10/18/2026 5:21:58 PM
+ *  Author: Demiana Younes
+ */ 
+
+
+#ifndef SOFTTIMER_CONFIG_H_
+#define SOFTTIMER_CONFIG_H_
+
+/*size of the timers pool (less than 255)*/
+#define SOFTTIMER_MAX_TIMERS      24
+
+/*wheel slots = 2^SOFTTIMER_WHEEL_SHIFT, about the number of running timers keeps a short list per tick*/
+#define SOFTTIMER_WHEEL_SHIFT     4
+
+/*1 tick = 1ms = 1000 Timer1 ticks of SysTime (SYSTIME_TICKS_PER_US 1)*/
+#define SOFTTIMER_TICK_COUNTS     1000
+
+
+
+#endif /* SOFTTIMER_CONFIG_H_ */
\ No newline at end of file
@@ -0,0 +1,53 @@
+/*
+ * SoftTimer_Interface.h
+ *
+ * Created: 10/18/2026 5:21:40 PM
+ *  Author: Demiana Younes
+ */ 
+
+
+#ifndef SOFTTIMER_INTERFACE_H_
+#define SOFTTIMER_INTERFACE_H_
+
+typedef enum{
+	SOFTTIMER_ONE_SHOT=0,
+	SOFTTIMER_PERIODIC
+	}SoftTimer_Mode_type;
+
+/**
+ * @brief Starts the tick of all the software timers on Timer1 compare A.
+ *        Timer1 keeps running free for SysTime, so SysTime_Init must be called first.
+ *        Takes the Timer1 compare A call back.
+ */
+void SoftTimer_Init(void);
+
+/**
+ * @brief Takes a free timer from the pool.
+ *
+ * @param Copy_pu8Id      returns the id used with the other functions.
+ * @param Copy_pfCallBack called from SoftTimer_Dispatch (main loop), never from the ISR.
+ * @param Copy_Mode       one shot or periodic.
+ * @return OK, NOK if the pool is full.
+ */
+Error_t SoftTimer_Create(u8*Copy_pu8Id,void(*Copy_pfCallBack)(void),SoftTimer_Mode_type Copy_Mode);
+
+/**
+ * @brief (Re)starts a timer, it expires after Copy_u16PeriodMs then every
+ *        Copy_u16PeriodMs if it is periodic. O(1).
+ */
+Error_t SoftTimer_Start(u8 Copy_u8Id,u16 Copy_u16PeriodMs);
+
+/**
+ * @brief Stops a timer and drops its pending call back. O(1).
+ */
+Error_t SoftTimer_Stop(u8 Copy_u8Id);
+
+u8 SoftTimer_IsRunning(u8 Copy_u8Id);
+
+/**
+ * @brief Runs the call backs of the expired timers, call it in the main loop.
+ *        A timer that expired more than once since the last dispatch is called once.
+ */
+void SoftTimer_Dispatch(void);
+
+#endif /* SOFTTIMER_INTERFACE_H_ */
\ No newline at end of file
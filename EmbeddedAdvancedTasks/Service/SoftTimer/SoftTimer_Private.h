@@ -0,0 +1,38 @@
+/*
+ * SoftTimer_Private.h
+ *
+ * Created: 10/18/2026 5:22:15 PM
+ *  Author: Demiana Younes
+ */ 
+
+
+#ifndef SOFTTIMER_PRIVATE_H_
+#define SOFTTIMER_PRIVATE_H_
+
+#define SOFTTIMER_WHEEL_SIZE      (1<<SOFTTIMER_WHEEL_SHIFT)
+#define SOFTTIMER_WHEEL_MASK      (SOFTTIMER_WHEEL_SIZE-1)
+#define SOFTTIMER_NONE            0xFF
+
+/*timer states*/
+#define SOFTTIMER_FREE            0
+#define SOFTTIMER_STOPPED         1
+#define SOFTTIMER_RUNNING         2
+
+/*ready queue states*/
+#define SOFTTIMER_NOT_QUEUED      0
+#define SOFTTIMER_QUEUED          1
+#define SOFTTIMER_CANCELLED       2
+
+#if SOFTTIMER_MAX_TIMERS>=255
+#error "SOFTTIMER_MAX_TIMERS must be less than 255"
+#endif
+
+static void SoftTimer_Insert(u8 Copy_u8Id,u16 Copy_u16Delay);
+static void SoftTimer_Remove(u8 Copy_u8Id);
+static void SoftTimer_SetPending(u8 Copy_u8Id);
+static void SoftTimer_CancelPending(u8 Copy_u8Id);
+static void SoftTimer_TickCallBack(void);
+
+
+
+#endif /* SOFTTIMER_PRIVATE_H_ */
\ No newline at end of file
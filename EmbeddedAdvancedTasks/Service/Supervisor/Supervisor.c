@@ -0,0 +1,137 @@
+/*
+ * Supervisor.c
+ *
+ * Created: 10/18/2026 9:40:52 PM
+ *  Author: Demiana Younes
+ */ 
+
+#include "StdTypes.h"
+#include "MemMap.h"
+
+#include "WDT_Interface.h"
+#include "Timer_Interface.h"
+
+#include "Supervisor_Interface.h"
+#include "Supervisor_Config.h"
+#include "Supervisor_Private.h"
+
+static Supervisor_Report_type Supervisor_Report __attribute__((section(".noinit")));
+
+static u16 Supervisor_Deadlines[SUPERVISOR_MAX_TASKS];
+static volatile u16 Supervisor_Remaining[SUPERVISOR_MAX_TASKS];
+static u8 Supervisor_TasksNumber=0;
+static u8 Supervisor_ResetTask=SUPERVISOR_NO_RESET;
+
+void Supervisor_Init(void)
+{
+	u8 Local_u8Check=(u8)~Supervisor_Report.Task;
+	u8 Local_u8Valid=(Supervisor_Report.Magic==SUPERVISOR_MAGIC)&&
+	                 (Supervisor_Report.Check==Local_u8Check);
+	if(MCUCSR&(1<<WDRF))
+	{
+		Supervisor_ResetTask=Local_u8Valid?Supervisor_Report.Task:SUPERVISOR_UNKNOWN_TASK;
+		if((Local_u8Valid==0)||(MCUCSR&(1<<PORF)))
+		{
+			Supervisor_Report.Resets=0;
+		}
+		if(Supervisor_Report.Resets<0xFF)
+		{
+			Supervisor_Report.Resets++;
+		}
+	}
+	else if((Local_u8Valid==0)||(MCUCSR&(1<<PORF)))
+	{
+		/*power on : the RAM holds garbage*/
+		Supervisor_Report.Resets=0;
+	}
+	/*the flags stay set until they are cleared*/
+	MCUCSR&=~((1<<WDRF)|(1<<BORF)|(1<<EXTRF)|(1<<PORF));
+	Supervisor_Report.Magic=SUPERVISOR_MAGIC;
+	Supervisor_Report.Task=SUPERVISOR_UNKNOWN_TASK;
+	Supervisor_Report.Check=(u8)~SUPERVISOR_UNKNOWN_TASK;
+	Supervisor_TasksNumber=0;
+
+	WDT_Set(SUPERVISOR_WDT_TIMEOUT);
+	TIMER2_OC_SetCallBack(Supervisor_Tick);
+	TIMER2_CONFIGURE_PERIOD(SUPERVISOR_TICK_US);
+	TIMER2_OC_InterruptEnable();
+}
+
+Error_t Supervisor_Register(u8*Copy_pu8Id,u16 Copy_u16DeadlineMs)
+{
+	Error_t Local_Status=OK;
+	u8 sreg;
+	if(Supervisor_TasksNumber>=SUPERVISOR_MAX_TASKS)
+	{
+		Local_Status=NOK;
+	}
+	else
+	{
+		sreg=SREG;
+		cli();
+		Supervisor_Deadlines[Supervisor_TasksNumber]=SUPERVISOR_TICKS(Copy_u16DeadlineMs);
+		Supervisor_Remaining[Supervisor_TasksNumber]=Supervisor_Deadlines[Supervisor_TasksNumber];
+		*Copy_pu8Id=Supervisor_TasksNumber;
+		Supervisor_TasksNumber++;
+		SREG=sreg;
+	}
+	return Local_Status;
+}
+
+void Supervisor_CheckIn(u8 Copy_u8Id)
+{
+	u8 sreg;
+	if(Copy_u8Id<Supervisor_TasksNumber)
+	{
+		sreg=SREG;
+		cli();
+		Supervisor_Remaining[Copy_u8Id]=Supervisor_Deadlines[Copy_u8Id];
+		SREG=sreg;
+	}
+}
+
+u8 Supervisor_GetResetTask(void)
+{
+	return Supervisor_ResetTask;
+}
+
+u8 Supervisor_GetResetCount(void)
+{
+	return Supervisor_Report.Resets;
+}
+
+static void Supervisor_Tick(void)
+{
+	u8 Local_u8Task;
+	u8 Local_u8Starving=SUPERVISOR_UNKNOWN_TASK;
+	for(Local_u8Task=0;Local_u8Task<Supervisor_TasksNumber;Local_u8Task++)
+	{
+		if(Supervisor_Remaining[Local_u8Task]==0)
+		{
+			if(Local_u8Starving==SUPERVISOR_UNKNOWN_TASK)
+			{
+				Local_u8Starving=Local_u8Task;
+			}
+		}
+		else
+		{
+			Supervisor_Remaining[Local_u8Task]--;
+		}
+	}
+	if(Local_u8Starving==SUPERVISOR_UNKNOWN_TASK)
+	{
+		WDT_Reset();
+		if(Supervisor_Report.Task!=SUPERVISOR_UNKNOWN_TASK)
+		{
+			/*the starving task checked in late , a later reset must not blame it*/
+			Supervisor_Report.Task=SUPERVISOR_UNKNOWN_TASK;
+			Supervisor_Report.Check=(u8)~SUPERVISOR_UNKNOWN_TASK;
+		}
+	}
+	else if(Supervisor_Report.Task==SUPERVISOR_UNKNOWN_TASK)
+	{
+		/*the first task that starved is kept , the watchdog resets the MCU in SUPERVISOR_WDT_TIMEOUT*/
+		Supervisor_Report.Task=Local_u8Starving;
+		Supervisor_Report.Check=(u8)~Local_u8Starving;
+	}
+}
\ No newline at end of file
@@ -0,0 +1,20 @@
+/*
+ * Supervisor_Config.h
+ *
+ * Created: 10/18/2026 9:41:25 PM
+ *  Author: Demiana Younes
+ */ 
+
+
+#ifndef SUPERVISOR_CONFIG_H_
+#define SUPERVISOR_CONFIG_H_
+
+#define SUPERVISOR_MAX_TASKS     8
+
+/*the deadlines are checked and the watchdog is kicked every SUPERVISOR_TICK_US on Timer2*/
+#define SUPERVISOR_TICK_US       10000
+
+/*reset comes this long after the first missed deadline*/
+#define SUPERVISOR_WDT_TIMEOUT   TimeOut_260ms
+
+#endif /* SUPERVISOR_CONFIG_H_ */
\ No newline at end of file
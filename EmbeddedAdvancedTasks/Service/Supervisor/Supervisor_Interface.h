@@ -0,0 +1,53 @@
+/*
+ * Supervisor_Interface.h
+ *
+ * Created: 10/18/2026 9:41:07 PM
+ *  Author: Demiana Younes
+ */ 
+
+
+#ifndef SUPERVISOR_INTERFACE_H_
+#define SUPERVISOR_INTERFACE_H_
+
+/*Supervisor_GetResetTask when the last reset was not from the watchdog*/
+#define SUPERVISOR_NO_RESET        0xFF
+/*watchdog reset with no task recorded (ex: a hang with the interrupts disabled)*/
+#define SUPERVISOR_UNKNOWN_TASK    0xFE
+
+/**
+ * @brief Reads the report left by the previous run in .noinit RAM, then
+ *        starts the watchdog and the deadlines check on Timer2 compare.
+ *
+ *        Takes Timer2 (CTC mode) and its compare call back, so it can't be
+ *        used with the Timer2 RTC or a motor on OC2. Call it first in the
+ *        init, before the drivers that may block. The watchdog runs from
+ *        here, so the global interrupt must be enabled within
+ *        SUPERVISOR_WDT_TIMEOUT.
+ */
+void Supervisor_Init(void);
+
+/**
+ * @brief Adds a task that must call Supervisor_CheckIn at least every
+ *        Copy_u16DeadlineMs. The first deadline starts now.
+ *
+ * @return OK, NOK if SUPERVISOR_MAX_TASKS tasks are registered.
+ */
+Error_t Supervisor_Register(u8*Copy_pu8Id,u16 Copy_u16DeadlineMs);
+
+/**
+ * @brief The task is alive, its deadline starts again.
+ */
+void Supervisor_CheckIn(u8 Copy_u8Id);
+
+/**
+ * @brief Task that missed its deadline before the last reset,
+ *        SUPERVISOR_NO_RESET or SUPERVISOR_UNKNOWN_TASK.
+ */
+u8 Supervisor_GetResetTask(void);
+
+/**
+ * @brief Watchdog resets since the last power on (saturates at 255).
+ */
+u8 Supervisor_GetResetCount(void);
+
+#endif /* SUPERVISOR_INTERFACE_H_ */
\ No newline at end of file
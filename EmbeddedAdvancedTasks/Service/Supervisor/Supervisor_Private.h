@@ -0,0 +1,35 @@
+/*
+ * Supervisor_Private.h
+ *
+ * Created: 10/18/2026 9:41:44 PM
+ *  Author: Demiana Younes
+ */ 
+
+
+#ifndef SUPERVISOR_PRIVATE_H_
+#define SUPERVISOR_PRIVATE_H_
+
+#define SUPERVISOR_MAGIC         0xA55AU
+
+#define SUPERVISOR_TICK_MS       (SUPERVISOR_TICK_US/1000)
+#define SUPERVISOR_TICKS(ms)     (((ms)+SUPERVISOR_TICK_MS-1)/SUPERVISOR_TICK_MS)
+
+#if (SUPERVISOR_TICK_US%1000)!=0
+#error "SUPERVISOR : SUPERVISOR_TICK_US must be whole milliseconds"
+#endif
+
+/*kept in RAM through the watchdog reset (.noinit is not cleared by the start up code)*/
+typedef struct{
+	u16 Magic;
+	u8  Task;         /*task that starved , SUPERVISOR_UNKNOWN_TASK while all are healthy*/
+	u8  Resets;
+	u8  Check;        /*~Task , catches a RAM that was not kept*/
+	}Supervisor_Report_type;
+
+/**
+ * @brief Timer2 compare call back : counts the deadlines down and kicks the
+ *        watchdog only if no task has reached 0.
+ */
+static void Supervisor_Tick(void);
+
+#endif /* SUPERVISOR_PRIVATE_H_ */
\ No newline at end of file
@@ -0,0 +1,71 @@
+/*
+ * SysTime.c
+ *
+ * Created: 10/18/2026 4:04:57 PM
+ *  Author: Demiana Younes
+ */ 
+
+#include "StdTypes.h"
+#include "Utils.h"
+#include "MemMap.h"
+
+#include "Timer_Interface.h"
+
+#include "SysTime_Interface.h"
+#include "SysTime_Config.h"
+#include "SysTime_Private.h"
+
+/*high 16 bit of the time*/
+static volatile u16 SysTime_Overflows=0;
+
+void SysTime_Init(void)
+{
+	SysTime_Overflows=0;
+	Timer1_OVF_SetCallBack(SysTime_OverflowCallBack);
+	Timer1_Init(TIMER1_NORMAL_MODE,SYSTIME_SCALER);
+	Timer1_OVF_InterruptEnable();
+}
+
+u32 SysTime_Ticks(void)
+{
+	u32 Local_u32Ticks;
+	u8 Local_u8Sreg=SREG;
+	cli();
+	Local_u32Ticks=SysTime_Extend(TCNT1);
+	/*restore the interrupt state, works from inside an ISR too*/
+	SREG=Local_u8Sreg;
+	return Local_u32Ticks;
+}
+
+u32 SysTime_Micros(void)
+{
+	return SysTime_Ticks()/SYSTIME_TICKS_PER_US;
+}
+
+u32 SysTime_CaptureTicks(void)
+{
+	/*ICU has a higher priority than OVF so the overflow can still be pending here*/
+	return SysTime_Extend(ICR1);
+}
+
+/**
+ * @brief Joins the overflow counter with a counter value, interrupts must be off.
+ *
+ *        If TOV1 is set the overflow ISR did not run yet: a small counter value
+ *        was taken after the overflow and needs one more, a big one was taken
+ *        just before it and is already right.
+ */
+static u32 SysTime_Extend(u16 Copy_u16Counter)
+{
+	u16 Local_u16Overflows=SysTime_Overflows;
+	if(READ_BIT(TIFR,TOV1)&&(Copy_u16Counter<SYSTIME_HALF_PERIOD))
+	{
+		Local_u16Overflows++;
+	}
+	return ((u32)Local_u16Overflows<<16)|Copy_u16Counter;
+}
+
+static void SysTime_OverflowCallBack(void)
+{
+	SysTime_Overflows++;
+}
\ No newline at end of file
@@ -0,0 +1,18 @@
+/*
+ * SysTime_Config.h
+ *
+ * Created: 10/18/2026 4:05:36 PM
+ *  Author: Demiana Younes
+ */ 
+
+
+#ifndef SYSTIME_CONFIG_H_
+#define SYSTIME_CONFIG_H_
+
+/*TIMER1_SCALER_8 at 8MHz --> 1 tick = 1us , wraps after 71 minutes*/
+#define SYSTIME_SCALER         TIMER1_SCALER_8
+#define SYSTIME_TICKS_PER_US   1
+
+
+
+#endif /* SYSTIME_CONFIG_H_ */
\ No newline at end of file
@@ -0,0 +1,34 @@
+/*
+ * SysTime_Interface.h
+ *
+ * Created: 10/18/2026 4:05:18 PM
+ *  Author: Demiana Younes
+ */ 
+
+
+#ifndef SYSTIME_INTERFACE_H_
+#define SYSTIME_INTERFACE_H_
+
+/**
+ * @brief Starts Timer1 in normal mode and counts its overflows to extend
+ *        TCNT1 to 32 bit. Takes the Timer1 overflow call back.
+ */
+void SysTime_Init(void);
+
+/**
+ * @brief Monotonic 32 bit Timer1 ticks, safe from the main loop and from ISRs.
+ */
+u32 SysTime_Ticks(void);
+
+/**
+ * @brief SysTime_Ticks converted to microseconds.
+ */
+u32 SysTime_Micros(void);
+
+/**
+ * @brief 32 bit time of the last input capture (ICR1).
+ *        Call it from the Timer1 ICU call back.
+ */
+u32 SysTime_CaptureTicks(void);
+
+#endif /* SYSTIME_INTERFACE_H_ */
\ No newline at end of file
@@ -0,0 +1,21 @@
+/*
+ * SysTime_Private.h
+ *
+ * Created: 10/18/2026 4:05:52 PM
+ *  Author: Demiana Younes
+ */ 
+
+
+#ifndef SYSTIME_PRIVATE_H_
+#define SYSTIME_PRIVATE_H_
+
+/*a counter value in the first half of the period read with TOV1 still set
+ *was read after the overflow that the ISR did not count yet*/
+#define SYSTIME_HALF_PERIOD    0x8000
+
+static u32 SysTime_Extend(u16 Copy_u16Counter);
+static void SysTime_OverflowCallBack(void);
+
+
+
+#endif /* SYSTIME_PRIVATE_H_ */
\ No newline at end of file